@@ -5,6 +5,7 @@
 
 #include "../Models/Move.h"
 #include "../Models/Project_path.h"
+#include "BoardState.h"
 
 #ifdef APPLE
 #include <SDL2/SDL.h>
@@ -16,7 +17,8 @@
 
 using namespace std;
 
-class Board
+//   :      BoardState,     
+class Board : public BoardState
 {
 public:
     //   
@@ -38,7 +40,7 @@ public:
         }
 
         //   ,    
-        if (W == 0  H == 0)
+        if (W == 0 || H == 0)
         {
             SDL_DisplayMode dm;
             //      
@@ -78,7 +80,7 @@ public:
         replay = IMG_LoadTexture(ren, replay_path.c_str());
 
         //    
-        if (!board  !w_piece  !b_piece  !w_queen  !b_queen  !back  !replay)
+        if (!board || !w_piece || !b_piece || !w_queen || !b_queen || !back || !replay)
         {
             print_exception("IMG_LoadTexture can't load main textures from " + textures_path);
             return 1;
@@ -86,7 +88,7 @@ public:
 
         //   
         SDL_GetRendererOutputSize(ren, &W, &H);
-        make_start_mtx(); //    
+        reset(); //    
         rerender(); //  
         return 0; //  
     }
@@ -95,9 +97,7 @@ public:
     void redraw()
     {
         game_results = -1; //   
-        history_mtx.clear(); //   
-        history_beat_series.clear(); //    
-        make_start_mtx(); //    
+        reset(); //      
         clear_active(); //   
         clear_highlight(); //  
     }
@@ -105,62 +105,31 @@ public:
     //          
     void move_piece(move_pos turn, const int beat_series = 0)
     {
-        if (turn.xb != -1) //    
-        {
-
-            mtx[turn.xb][turn.yb] = 0; //  ,    
-        }
-        move_piece(turn.x, turn.y, turn.x2, turn.y2, beat_series); //  
+        BoardState::move_piece(turn, beat_series); //  
+        rerender(); //  
     }
 
     //       
     void move_piece(const POS_T i, const POS_T j, const POS_T i2, const POS_T j2, const int beat_series = 0)
     {
-        // ,    
-        if (mtx[i2][j2])
-        {
-            throw runtime_error("final position is not empty, can't move"); // ,    
-        }
-        // ,     
-        if (!mtx[i][j])
-        {
-            throw runtime_error("begin position is empty, can't move"); // ,    
-        }
-        //      
-        if ((mtx[i][j] == 1 && i2 == 0)  (mtx[i][j] == 2 && i2 == 7))
-            mtx[i][j] += 2; //    2  
-
-        mtx[i2][j2] = mtx[i][j]; //  
-        drop_piece(i, j); //     
-        add_history(beat_series); //      
+        BoardState::move_piece(i, j, i2, j2, beat_series); //  
+        rerender(); //  
     }
 
     //      
     void drop_piece(const POS_T i, const POS_T j)
     {
-        mtx[i][j] = 0; //  
+        BoardState::drop_piece(i, j); //  
         rerender(); //  
     }
 
     //       
     void turn_into_queen(const POS_T i, const POS_T j)
     {
-        // ,      
-        if (mtx[i][j] == 0 || mtx[i][j] > 2)
-        {
-            throw runtime_error("can't turn into queen in this position"); // ,   
-        }
-
-        mtx[i][j] += 2; //   
+        BoardState::turn_into_queen(i, j); //   
         rerender(); //  
     }
 
-    //      
-    vector<vector<POS_T>> get_board() const
-    {
-        return mtx; //  
-    }
-
     //     
     void highlight_cells(vector<pair<POS_T, POS_T>> cells)
     {
@@ -207,13 +176,7 @@ public:
     //     
     void rollback()
     {
-        auto beat_series = max(1, *(history_beat_series.rbegin())); //     
-        while (beat_series-- && history_mtx.size() > 1)
-        {
-            history_mtx.pop_back(); //     
-            history_beat_series.pop_back(); //    
-        }
-        mtx = *(history_mtx.rbegin()); //      
+        BoardState::rollback(); //      
         clear_highlight(); //  
         clear_active(); //   
     }
@@ -256,33 +219,6 @@ public:
     }
 
 private:
-    //       
-    void add_history(const int beat_series = 0)
-    {
-        history_mtx.push_back(mtx); //    
-        history_beat_series.push_back(beat_series); //    
-    }
-
-    //        
-    void make_start_mtx()
-    {
-        for (POS_T i = 0; i < 8; ++i)
-        {
-            for (POS_T j = 0; j < 8; ++j)
-            {
-                mtx[i][j] = 0; //    
-                //   
-                if (i < 3 && (i + j) % 2 == 1)
-                    mtx[i][j] = 2; //  
-                //   
-
-                if (i > 4 && (i + j) % 2 == 1)
-                    mtx[i][j] = 1; //  
-            }
-        }
-        add_history(); //     
-    }
-
     //       
     void rerender()
     {
@@ -390,8 +326,6 @@ private:
 public:
     int W = 0; //  
     int H = 0; //  
-    //       
-    vector<vector<vector<POS_T>>> history_mtx;
 
 private:
     SDL_Window* win = nullptr; //    SDL
@@ -425,10 +359,4 @@ private:
     int game_results = -1;
     //    ( )
     vector<vector<bool>> is_highlighted_ = vector<vector<bool>>(8, vector<bool>(8, 0));
-
-    //     
-    // 1 -  , 2 -  , 3 -  , 4 -  
-    vector<vector<POS_T>> mtx = vector<vector<POS_T>>(8, vector<POS_T>(8, 0));
-    //     
-    vector<int> history_beat_series;
 };
\ No newline at end of file
@@ -0,0 +1,164 @@
+#pragma once
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "../Models/Position.h"
+
+using namespace std;
+
+//    :  ,        .
+//    SDL,        (Match, Tools/headless),
+//  Board         
+class BoardState
+{
+public:
+    BoardState()
+    {
+        reset();
+    }
+
+    //         
+    void reset()
+    {
+        history_mtx.clear(); //   
+        history_beat_series.clear(); //    
+        make_start_mtx(); //    
+    }
+
+    //        ,    
+    void set_position(const Position& pos)
+    {
+        history_mtx.clear();
+        history_beat_series.clear();
+        mtx = pos.to_mtx(); //     
+        add_history();
+    }
+
+    //          
+    void move_piece(move_pos turn, const int beat_series = 0)
+    {
+        if (turn.xb != -1) //    
+        {
+            mtx[turn.xb][turn.yb] = 0; //  ,    
+        }
+        move_piece(turn.x, turn.y, turn.x2, turn.y2, beat_series); //  
+    }
+
+    //       
+    void move_piece(const POS_T i, const POS_T j, const POS_T i2, const POS_T j2, const int beat_series = 0)
+    {
+        // ,    
+        if (mtx[i2][j2])
+        {
+            throw runtime_error("final position is not empty, can't move"); // ,    
+        }
+        // ,     
+        if (!mtx[i][j])
+        {
+            throw runtime_error("begin position is empty, can't move"); // ,    
+        }
+        //      
+        if ((mtx[i][j] == 1 && i2 == 0) || (mtx[i][j] == 2 && i2 == 7))
+            mtx[i][j] += 2; //    2  
+
+        mtx[i2][j2] = mtx[i][j]; //  
+        drop_piece(i, j); //     
+        add_history(beat_series); //      
+    }
+
+    //      (  -   ), beat_series -   
+    void make_turn(const full_move& turn, int beat_series = 0)
+    {
+        for (const auto& step : turn.steps())
+        {
+            beat_series += (step.xb != -1); //    
+            move_piece(step, beat_series);
+        }
+    }
+
+    //      
+    void drop_piece(const POS_T i, const POS_T j)
+    {
+        mtx[i][j] = 0; //  
+    }
+
+    //       
+    void turn_into_queen(const POS_T i, const POS_T j)
+    {
+        // ,      
+        if (mtx[i][j] == 0 || mtx[i][j] > 2)
+        {
+            throw runtime_error("can't turn into queen in this position"); // ,   
+        }
+
+        mtx[i][j] += 2; //   
+    }
+
+    //        , color -  
+    Position get_position(const bool color) const
+    {
+        return Position::from_mtx(mtx, color); //     
+    }
+
+    //     
+    void rollback()
+    {
+        auto beat_series = max(1, *(history_beat_series.rbegin())); //     
+        while (beat_series-- && history_mtx.size() > 1)
+        {
+            history_mtx.pop_back(); //     
+            history_beat_series.pop_back(); //    
+        }
+        mtx = *(history_mtx.rbegin()); //      
+    }
+
+    //   : turn_num -  ,       ,
+    //  max_turns,      . 0 - , 1 -  , 2 -  
+    static int result(const int turn_num, const int max_turns)
+    {
+        if (turn_num >= max_turns)
+            return 0; // 
+        return (turn_num % 2 ? 1 : 2); //  ,   
+    }
+
+protected:
+    //       
+    void add_history(const int beat_series = 0)
+    {
+        history_mtx.push_back(mtx); //    
+        history_beat_series.push_back(beat_series); //    
+    }
+
+    //        
+    void make_start_mtx()
+    {
+        for (POS_T i = 0; i < 8; ++i)
+        {
+            for (POS_T j = 0; j < 8; ++j)
+            {
+                mtx[i][j] = 0; //    
+                //   
+                if (i < 3 && (i + j) % 2 == 1)
+                    mtx[i][j] = 2; //  
+                //   
+
+                if (i > 4 && (i + j) % 2 == 1)
+                    mtx[i][j] = 1; //  
+            }
+        }
+        add_history(); //     
+    }
+
+public:
+    //       
+    vector<vector<vector<POS_T>>> history_mtx;
+
+protected:
+    //     
+    // 1 -  , 2 -  , 3 -  , 4 -  
+    vector<vector<POS_T>> mtx = vector<vector<POS_T>>(8, vector<POS_T>(8, 0));
+    //     
+    vector<int> history_beat_series;
+};
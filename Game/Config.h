@@ -23,13 +23,15 @@ public:
      *       config.
      *    ,    .
      *
+     *    :  settings.json     .
+     *
      * :         
      *  JSON,     ,     .
      */
     void reload()
     {
         std::ifstream fin(project_path + "settings.json"); //   
-        fin >> config; //      JSON
+        config = json::parse(fin, nullptr, true, /*ignore_comments=*/true); //      JSON
         fin.close(); //  
     }
 
@@ -50,6 +52,41 @@ public:
         return config[setting_dir][setting_name]; //     JSON-
     }
 
+    /**
+     *     ,  settings.json  .
+     *
+     *   ,      .
+     *  : config.set("Bot", "Optimization", "O0").
+     */
+    template <class T> void set(const std::string& setting_dir, const std::string& setting_name, const T& value)
+    {
+        config[setting_dir][setting_name] = value;
+    }
+
+    /**
+     *      ".="    .
+     *
+     *  true / false  ,    - ,  - .
+     *  : config.set_option("Bot.Optimization=O0").
+     *
+     * @return  false,      ".=".
+     */
+    bool set_option(const std::string& option)
+    {
+        const size_t dot = option.find('.'), eq = option.find('=');
+        if (dot == std::string::npos || eq == std::string::npos || dot > eq)
+            return false;
+        const std::string dir = option.substr(0, dot), name = option.substr(dot + 1, eq - dot - 1);
+        const std::string value = option.substr(eq + 1);
+        if (value == "true" || value == "false")
+            set(dir, name, value == "true");
+        else if (!value.empty() && value.find_first_not_of("0123456789") == std::string::npos)
+            set(dir, name, std::stoi(value));
+        else
+            set(dir, name, value);
+        return true;
+    }
+
 private:
     json config; //  JSON,    
 };
\ No newline at end of file
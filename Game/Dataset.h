@@ -0,0 +1,251 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "../Models/Position.h"
+#include "MappedFile.h"
+
+//         : ,  ,    ,
+//  .  -     ;   ,  ,
+//   ,     
+
+const uint32_t DATASET_VERSION = 1; //   
+const uint32_t DATASET_CHUNK = 4096; //   ,   DatasetWriter
+
+//  ,   : dataset_chunk_header  count  dataset_record
+struct dataset_file_header
+{
+    char magic[4]; // "CKDS"
+    uint32_t version; // DATASET_VERSION
+    uint32_t record_size; // sizeof(dataset_record)
+    uint32_t reserved;
+};
+
+//   
+struct dataset_chunk_header
+{
+    char magic[4]; // "CKDC"
+    uint32_t count; //   
+};
+
+//  , ,    -    ,   
+struct dataset_record
+{
+    uint32_t white, black, kings; //   Position
+    uint8_t color; //  : 0 - , 1 - 
+    int8_t result; //  : 1 - , 0 - , -1 - 
+    int16_t score; //      
+    uint64_t move; //     packed_move
+
+    static dataset_record of(const Position& pos, const int score, const full_move& move)
+    {
+        dataset_record rec;
+        rec.white = pos.white;
+        rec.black = pos.black;
+        rec.kings = pos.kings;
+        rec.color = pos.color;
+        rec.result = 0;
+        rec.score = int16_t(score < -32767 ? -32767 : score > 32767 ? 32767 : score);
+        rec.move = packed_move(move).bits;
+        return rec;
+    }
+
+    Position position() const
+    {
+        Position pos;
+        pos.white = white;
+        pos.black = black;
+        pos.kings = kings;
+        pos.color = color;
+        return pos;
+    }
+};
+
+//    :    ,     ,  
+//    . write      
+class DatasetWriter
+{
+public:
+    DatasetWriter() = default;
+
+    ~DatasetWriter()
+    {
+        close();
+    }
+
+    DatasetWriter(const DatasetWriter&) = delete;
+    DatasetWriter& operator=(const DatasetWriter&) = delete;
+
+    //   path (  ), false -   
+    bool open(const std::string& path)
+    {
+        close();
+        out = fopen(path.c_str(), "wb");
+        if (!out)
+            return false;
+        const dataset_file_header header = { { 'C', 'K', 'D', 'S' }, DATASET_VERSION, uint32_t(sizeof(dataset_record)), 0 };
+        fwrite(&header, sizeof(header), 1, out);
+        done = false;
+        records = 0;
+        worker = std::thread(&DatasetWriter::write_chunks, this);
+        return true;
+    }
+
+    //  ;       ,   
+    void write(const dataset_record* data, const size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        for (size_t i = 0; i < count; ++i)
+        {
+            //        ,       ,  
+            //   ,       DATASET_CHUNK 
+            while (pending.size() >= DATASET_CHUNK)
+            {
+                space.wait(lock, [this]() { return queue.size() < MAX_QUEUE; });
+                if (pending.size() >= DATASET_CHUNK) //      
+                {
+                    queue.push_back(std::move(pending));
+                    pending.clear();
+                    ready.notify_one();
+                }
+            }
+            pending.push_back(data[i]);
+        }
+        records += count;
+    }
+
+    //   ,      
+    void close()
+    {
+        if (!out)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!pending.empty())
+                queue.push_back(std::move(pending));
+            pending.clear();
+            done = true;
+        }
+        ready.notify_one();
+        worker.join();
+        fclose(out);
+        out = nullptr;
+    }
+
+    //   
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        return records;
+    }
+
+private:
+    static const size_t MAX_QUEUE = 16; //    ,  - write 
+
+    //  :      ,    
+    void write_chunks()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true)
+        {
+            ready.wait(lock, [this]() { return !queue.empty() || done; });
+            if (queue.empty())
+                return;
+            std::vector<dataset_record> chunk = std::move(queue.front());
+            queue.pop_front();
+            space.notify_all();
+            lock.unlock();
+            const dataset_chunk_header header = { { 'C', 'K', 'D', 'C' }, uint32_t(chunk.size()) };
+            fwrite(&header, sizeof(header), 1, out);
+            fwrite(chunk.data(), sizeof(dataset_record), chunk.size(), out);
+            lock.lock();
+        }
+    }
+
+    FILE* out = nullptr; //  
+    std::thread worker; //  
+    mutable std::mutex mtx; //  pending, queue, done  records
+    std::condition_variable ready; //       
+    std::condition_variable space; //    
+    std::vector<dataset_record> pending; //  
+    std::deque<std::vector<dataset_record>> queue; //    
+    bool done = false; //    
+    size_t records = 0; //  
+};
+
+//  ,   :    ,     
+class DatasetReader
+{
+public:
+    //  , false -      .    
+    bool open(const std::string& path)
+    {
+        chunks.clear();
+        records = 0;
+        if (!file.open(path) || file.size() < sizeof(dataset_file_header))
+            return false;
+        dataset_file_header header;
+        memcpy(&header, file.data(), sizeof(header));
+        if (memcmp(header.magic, "CKDS", 4) != 0 || header.version != DATASET_VERSION ||
+            header.record_size != sizeof(dataset_record))
+        {
+            file.close();
+            return false;
+        }
+        //  16  8 ,   24 ,     8    
+        size_t offset = sizeof(header);
+        while (offset + sizeof(dataset_chunk_header) <= file.size())
+        {
+            dataset_chunk_header chunk;
+            memcpy(&chunk, file.data() + offset, sizeof(chunk));
+            offset += sizeof(chunk);
+            if (memcmp(chunk.magic, "CKDC", 4) != 0 || offset + size_t(chunk.count) * sizeof(dataset_record) > file.size())
+                break;
+            chunks.emplace_back(reinterpret_cast<const dataset_record*>(file.data() + offset), size_t(chunk.count));
+            offset += size_t(chunk.count) * sizeof(dataset_record);
+            records += chunk.count;
+        }
+        return true;
+    }
+
+    //      
+    size_t size() const
+    {
+        return records;
+    }
+
+    //  ;    
+    size_t chunk_count() const
+    {
+        return chunks.size();
+    }
+
+    //   i   
+    const dataset_record* chunk(const size_t i, size_t& count) const
+    {
+        count = chunks[i].second;
+        return chunks[i].first;
+    }
+
+    //     
+    template <class F> void for_each(F f) const
+    {
+        for (const auto& chunk : chunks)
+            for (size_t i = 0; i < chunk.second; ++i)
+                f(chunk.first[i]);
+    }
+
+private:
+    MappedFile file; //   
+    std::vector<std::pair<const dataset_record*, size_t>> chunks; //      
+    size_t records = 0; //  
+};
@@ -0,0 +1,109 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "../Models/Move.h"
+#include "../Models/Position.h"
+
+//  ,     ( - 100),        int16_t
+const int MATE = 30000; //      ,   n  - MATE - n,  - 
+const int MATE_BOUND = MATE - 1000; //     -     n 
+const int INF = 32000; //   ,   
+
+//    ply    ( - )
+inline int mate_in(const int ply)
+{
+    return MATE - ply;
+}
+
+//  -     n 
+inline bool is_mate_score(const int score)
+{
+    return abs(score) > MATE_BOUND;
+}
+
+//     s:     0,    7
+inline int advance(const POS_T s, const bool color)
+{
+    return color ? square_x(s) : 7 - square_x(s);
+}
+
+//    ,  - : 0 - , 1 - .
+//     ,       
+struct eval_counters
+{
+    int men[2] = {}; //  
+    int kings[2] = {}; //  
+    int potential[2] = {}; //   
+
+    //     
+    void init(const Position& pos)
+    {
+        for (int col = 0; col < 2; ++col)
+        {
+            const uint32_t own = pos.pieces(col);
+            men[col] = bit_count(own & ~pos.kings);
+            kings[col] = bit_count(own & pos.kings);
+            potential[col] = 0;
+            for (uint32_t rest = own & ~pos.kings; rest; rest &= rest - 1)
+                potential[col] += advance(lowest_bit(rest), col);
+        }
+    }
+
+    //   (sign = 1)    (sign = -1); mover_king -  ,   
+    void update(const move_undo& undo, const bool mover_king, const int sign)
+    {
+        const bool col = undo.color, opp = !undo.color;
+        //   
+        if (undo.beaten)
+        {
+            const uint32_t beaten_men = undo.beaten & ~undo.beaten_kings;
+            kings[opp] -= sign * bit_count(undo.beaten_kings);
+            men[opp] -= sign * bit_count(beaten_men);
+            for (uint32_t rest = beaten_men; rest; rest &= rest - 1)
+                potential[opp] -= sign * advance(lowest_bit(rest), opp);
+        }
+        if (mover_king)
+            return; //       ,  
+        if (undo.promoted)
+        {
+            //         
+            men[col] -= sign;
+            kings[col] += sign;
+            potential[col] -= sign * advance(undo.from, col);
+        }
+        else
+            potential[col] += sign * (advance(undo.to, col) - advance(undo.from, col));
+    }
+};
+
+//       , white / black -    
+inline int material_diff(const int white, const int black, const bool first_bot_color)
+{
+    // color - who is max player
+    // color -   
+    return first_bot_color ? black - white : white - black;
+}
+
+//    (Bot.BotScoringType).   Logic -    ,  
+//    ,      .    -  
+//    score    Logic::search_root
+
+//   :  - 100,  - 400
+struct NumberOnly
+{
+    static int score(const eval_counters& c, const bool first_bot_color)
+    {
+        return material_diff(100 * c.men[0] + 400 * c.kings[0], 100 * c.men[1] + 400 * c.kings[1], first_bot_color);
+    }
+};
+
+//     :  - 500,  - 100   5    
+struct NumberAndPotential
+{
+    static int score(const eval_counters& c, const bool first_bot_color)
+    {
+        return material_diff(100 * c.men[0] + 5 * c.potential[0] + 500 * c.kings[0],
+            100 * c.men[1] + 5 * c.potential[1] + 500 * c.kings[1], first_bot_color);
+    }
+};
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -11,7 +12,7 @@
 class Game
 {
 public:
-    Game() : board(config("WindowSize", "Width"), config("WindowSize", "Hight")), hand(&board), logic(&board, &config)
+    Game() : board(config("WindowSize", "Width"), config("WindowSize", "Hight")), hand(&board), logic(&config)
     {
         //    -    
         ofstream fout(project_path + "log.txt", ios_base::trunc);
@@ -27,7 +28,7 @@ public:
         //    ,    
         if (is_replay)
         {
-            logic = Logic(&board, &config); //     
+            logic = Logic(&config); //     
             config.reload(); //  
             board.redraw(); //  
         }
@@ -45,9 +46,10 @@ public:
         while (++turn_num < Max_turns)
         {
             beat_series = 0; //   
-            logic.find_turns(turn_num % 2); //      
+            move_list turns; //    
+            find_all_turns(board.get_position(turn_num % 2), turns, true); //      
             //    ,  
-            if (logic.turns.empty())
+            if (turns.empty())
                 break;
 
             //           
@@ -57,7 +59,7 @@ public:
             if (!config("Bot", string("Is") + string((turn_num % 2) ? "Black" : "White") + string("Bot")))
             {
                 //  
-                auto resp = player_turn(turn_num % 2);
+                auto resp = player_turn(turn_num % 2, turns);
 
                 //    : , ,   
                 if (resp == Response::QUIT)
@@ -104,15 +106,7 @@ public:
             return 0; //   
 
         //   
-        int res = 2; //      
-        if (turn_num == Max_turns)
-        {
-            res = 0; // 
-        }
-        else if (turn_num % 2)
-        {
-            res = 1; //  
-        }
+        const int res = BoardState::result(turn_num, Max_turns); // 0 - , 1 -  , 2 -  
         board.show_final(res); //    
         auto resp = hand.wait(); //    
         if (resp == Response::REPLAY)
@@ -132,12 +126,12 @@ private:
         auto delay_ms = config("Bot", "BotDelayMS"); //    
         //       
         thread th(SDL_Delay, delay_ms);
-        auto turns = logic.find_best_turns(color); //     
+        const full_move best = logic.find_best_turns(board.get_position(color)); //     
         th.join(); //    
 
         bool is_first = true; //     
-        //   
-        for (auto turn : turns)
+        //     :      
+        for (auto turn : best.steps())
         {
             if (!is_first)
             {
@@ -151,19 +145,31 @@ private:
         //      
         auto end = chrono::steady_clock::now();
         ofstream fout(project_path + "log.txt", ios_base::app);
-        fout << "Bot turn time: " << (int)chrono::duration<double, milli>(end - start).count() << " millisec\n";
+        fout << "Bot turn time: " << (int)chrono::duration<double, milli>(end - start).count() << " millisec, nodes: "
+             << logic.searched_nodes();
+        const string optimization = config("Bot", "Optimization");
+        if (optimization == "O2")
+        {
+            //     
+            const search_stats& st = logic.pruning_stats();
+            fout << ", LMR: " << st.lmr << " (re-searched " << st.lmr_research << "), futility: " << st.futility
+                 << ", ProbCut: " << st.probcut_cuts << " of " << st.probcut;
+        }
+        fout << "\n";
         fout.close();
     }
 
-    Response player_turn(const bool color)
+    //  , turns -      (  -  )
+    //     ,       
+    Response player_turn(const bool color, const move_list& turns)
     {
         //         
         vector<pair<POS_T, POS_T>> cells;
 
         //       
-        for (auto turn : logic.turns)
+        for (const auto& turn : turns)
         {
-            cells.emplace_back(turn.x, turn.y); //    
+            cells.emplace_back(square_x(turn.from), square_y(turn.from)); //    
         }
 
         //      
@@ -186,18 +192,19 @@ private:
 
             bool is_correct = false; //     
             // ,     
-            for (auto turn : logic.turns)
+            for (const auto& turn : turns)
             {
+                const move_pos first = turn.step(0); //   
                 //         
-                if (turn.x == cell.first && turn.y == cell.second)
+                if (first.x == cell.first && first.y == cell.second)
                 {
                     is_correct = true; //  
                     break;
                 }
                 //        
-                if (turn == move_pos{ x, y, cell.first, cell.second })
+                if (first == move_pos{ x, y, cell.first, cell.second })
                 {
-                    pos = turn; //     
+                    pos = first; //     
                     break;
                 }
             }
@@ -231,11 +238,12 @@ private:
             //          
             vector<pair<POS_T, POS_T>> cells2;
             //      
-            for (auto turn : logic.turns)
+            for (const auto& turn : turns)
             {
-                if (turn.x == x && turn.y == y) //      
+                const move_pos first = turn.step(0);
+                if (first.x == x && first.y == y) //      
                 {
-                    cells2.emplace_back(turn.x2, turn.y2); //     
+                    cells2.emplace_back(first.x2, first.y2); //     
                 }
             }
             board.highlight_cells(cells2); //      
@@ -252,21 +260,25 @@ private:
         if (pos.xb == -1)
             return Response::OK;
 
-        //     
+        //     :   ,     
 
-        beat_series = 1; //     
-        while (true)
+        vector<full_move> series;
+        for (const auto& turn : turns)
         {
-            //      
-            logic.find_turns(pos.x2, pos.y2);
-            if (!logic.have_beats) //     
-                break; //   
+            if (packed_move(turn.step(0)) == packed_move(pos)) //        
+                series.push_back(turn);
+        }
 
+        beat_series = 1; //     
+        //         ,      
+        while (beat_series < series.front().len)
+        {
             //     ,   
             vector<pair<POS_T, POS_T>> cells;
-            for (auto turn : logic.turns)
+            for (const auto& turn : series)
             {
-                cells.emplace_back(turn.x2, turn.y2); //     
+                const move_pos next = turn.step(beat_series);
+                cells.emplace_back(next.x2, next.y2); //     
             }
 
             //     
@@ -283,18 +295,25 @@ private:
 
                 bool is_correct = false; //     
                 // ,        
-                for (auto turn : logic.turns)
+                for (const auto& turn : series)
                 {
-                    if (turn.x2 == cell.first && turn.y2 == cell.second) //       
+                    const move_pos next = turn.step(beat_series);
+                    if (next.x2 == cell.first && next.y2 == cell.second) //       
                     {
                         is_correct = true; //  
-                        pos = turn; //      
+                        pos = next; //      
                         break;
                     }
                 }
                 if (!is_correct) //   , 
                     continue; //       
 
+                //  ,   
+                const int step = beat_series;
+                series.erase(remove_if(series.begin(), series.end(),
+                                 [&](const full_move& turn) { return turn.step(step) != pos; }),
+                    series.end());
+
                 //     
                 board.clear_highlight();
                 board.clear_active();
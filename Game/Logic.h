@@ -1,389 +1,826 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <random>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "../Models/Move.h"
-#include "Board.h"
+#include "../Models/Position.h"
 #include "Config.h"
+#include "Eval.h"
+#include "MoveGen.h"
+#include "OpeningBook.h"
+#include "SearchCache.h"
+#include "Tablebase.h"
+#include "TransTable.h"
 
-const int INF = 1e9;
+using namespace std;
 
+const int MAX_PLY = 64; //      
+const int ASPIRATION_WINDOW = 50; //       (O1), 
+
+//   O2   Pruning,    ,     
+struct pruning_params
+{
+    int lmr_moves = 3; //      
+    int lmr_min_depth = 3; //       
+    int lmr_reduction = 1; //   
+    int futility_depth = 2; //      futility
+    int futility_margin = 120; //      
+    int probcut_depth = 5; //      ProbCut
+    int probcut_reduction = 3; //     
+    int probcut_margin = 80; //       
+};
+
+//   
+struct search_stats
+{
+    size_t lmr = 0; // ,    
+    size_t lmr_research = 0; //      
+    size_t futility = 0; // ,  futility
+    size_t probcut = 0; //   ProbCut
+    size_t probcut_cuts = 0; //    
+    size_t tablebase = 0; // ,      
+    size_t cache = 0; // ,    
+
+    search_stats& operator+=(const search_stats& other)
+    {
+        lmr += other.lmr;
+        lmr_research += other.lmr_research;
+        futility += other.futility;
+        probcut += other.probcut;
+        probcut_cuts += other.probcut_cuts;
+        tablebase += other.tablebase;
+        cache += other.cache;
+        return *this;
+    }
+};
+
+//     (ply -    ):   ,   ,
+// -      
+struct search_frame
+{
+    move_list turns; //    
+    move_undo undo; //  ,   
+    packed_move killers[2]; //  - 
+    full_move pv[MAX_PLY + 1]; //      
+    int pv_len = 0; //   
+};
+
+//     
+struct search_iteration
+{
+    int depth = 0; //  
+    size_t nodes = 0; //       
+    double ms = 0; //     
+    full_move best; //   
+    int score = 0; //   
+    search_stats stats; //  O2      
+    vector<full_move> pv; //   ,    
+};
+
+//   .    :   ,      
 class Logic
 {
 public:
-    //   Logic,     Board  Config
-    Logic(Board* board, Config* config) : board(board), config(config)
+    //   Logic,     Config
+    Logic(Config* config) : config(config)
     {
+        no_random = (*config)("Bot", "NoRandom");
         rand_eng = std::default_random_engine(
-            !((*config)("Bot", "NoRandom")) ? unsigned(time(0)) : 0);
-        scoring_mode = (*config)("Bot", "BotScoringType");
-        optimization = (*config)("Bot", "Optimization");
+            !no_random ? unsigned(time(0)) : 0);
+        const string scoring_mode = (*config)("Bot", "BotScoringType");
+        scoring = (scoring_mode == "NumberAndPotential" ? Scoring::NumberAndPotential : Scoring::NumberOnly);
+        const string optimization = (*config)("Bot", "Optimization");
+        opt_level = (optimization == "O0" ? Optimization::O0 : optimization == "O2" ? Optimization::O2 : Optimization::O1);
+        pruning.lmr_moves = (*config)("Pruning", "LmrMoves");
+        pruning.lmr_min_depth = (*config)("Pruning", "LmrMinDepth");
+        pruning.lmr_reduction = (*config)("Pruning", "LmrReduction");
+        pruning.futility_depth = (*config)("Pruning", "FutilityDepth");
+        pruning.futility_margin = (*config)("Pruning", "FutilityMargin");
+        pruning.probcut_depth = (*config)("Pruning", "ProbCutDepth");
+        pruning.probcut_reduction = (*config)("Pruning", "ProbCutReduction");
+        pruning.probcut_margin = (*config)("Pruning", "ProbCutMargin");
+        max_think_ms = (*config)("Bot", "MaxThinkMS");
+        tt = make_shared<TransTable>((*config)("Bot", "HashMB"));
+        const string tablebase_file = (*config)("Bot", "TablebaseFile");
+        if (!tablebase_file.empty())
+        {
+            auto tb = make_shared<Tablebase>();
+            if (tb->open(project_path + tablebase_file))
+                tablebase = tb; //       
+        }
+        const string book_file = (*config)("Bot", "BookFile");
+        if (!book_file.empty())
+        {
+            auto opening_book = make_shared<OpeningBook>();
+            if (opening_book->open(project_path + book_file))
+                book = opening_book; //       
+        }
+        const string cache_file = (*config)("Bot", "CacheFile");
+        cache_min_depth = (*config)("Bot", "CacheMinDepth");
+        if (!cache_file.empty())
+        {
+            auto search_cache = make_shared<SearchCache>();
+            if (search_cache->open(project_path + cache_file, (*config)("Bot", "CacheMB")))
+                cache = search_cache; //       
+        }
+        //      ,       
+        cache_salt = (scoring == Scoring::NumberAndPotential ? 0x5851F42D4C957F2Dull : 0);
+        threads = (*config)("Bot", "Threads");
+        if (threads == 0)
+            threads = max(1u, thread::hardware_concurrency()); // 0 -  
+        stop_all = make_shared<atomic<bool>>(false);
     }
-    //         true - , false - 
-    vector<move_pos> find_best_turns(const bool color)
+    //        pos   pos.color: false - , true - 
+    //     ,     full_move::steps()
+    //       0..Max_depth,    Bot.MaxThinkMS
+    //  Bot.Optimization O1           (aspiration window),
+    //  O2    :   , futility  ProbCut (   Pruning)
+    //  Bot.Threads > 1       (Lazy SMP),   
+    //     (Bot.BookFile)    (Bot.TablebaseFile)   
+    full_move find_best_turns(Position pos)
     {
-        next_best_state.clear(); //   
-        next_move.clear(); //   
+        const bool color = pos.color; //         
+        start_search(pos, color);
+        iterations.clear();
+        tt->new_search();
+        start_time = chrono::steady_clock::now(); //     
+
+        //  :  NoRandom = false   ,   
+        full_move book_move;
+        if (book && book->probe(pos, rand_eng, !no_random, book_move))
+        {
+            iterations.push_back({ 0, nodes,
+                chrono::duration<double, milli>(chrono::steady_clock::now() - start_time).count(), book_move, 0,
+                stats, { book_move } });
+            total_nodes = nodes;
+            total_stats = stats;
+            return book_move;
+        }
 
-        //    
-        vector<vector<POS_T>> mtx = board->get_board(); //   
-        double score = find_first_best_turn(mtx, color, -1, -1, 0, -1); //        
+        full_move tb_move;
+        int tb_score;
+        if (tablebase_root(pos, color, tb_move, tb_score))
+        {
+            iterations.push_back({ 0, nodes,
+                chrono::duration<double, milli>(chrono::steady_clock::now() - start_time).count(), tb_move, tb_score,
+                stats, { tb_move } });
+            total_nodes = nodes;
+            total_stats = stats;
+            return tb_move;
+        }
 
-        //   
-        int cur_state = 0; //  
-        vector<move_pos> res; //     
+        //   ,      
+        stop_all->store(false);
+        prepare_helpers();
+        vector<thread> workers;
+        for (size_t i = 0; i < helpers.size(); ++i)
+            workers.emplace_back(&Logic::helper_search, &helpers[i], pos, color, int(i + 1));
 
-        // ,    ,    
-        do
+        full_move res; //    
+        for (int depth = 0; depth <= Max_depth; ++depth)
         {
-            res.push_back(next_move[cur_state]); //     
-            cur_state = next_best_state[cur_state]; //    
-        } while (cur_state != -1 && next_move[cur_state].x != -1); // ,      
+            depth_limit = depth;
+            const int score = aspiration_search(pos, color); //      
+            if (stop_search)
+                break; //    ,   
+            res = best_turn;
+            iterations.push_back({ depth, nodes,
+                chrono::duration<double, milli>(chrono::steady_clock::now() - start_time).count(), res, score, stats,
+                vector<full_move>(frames[0].pv, frames[0].pv + frames[0].pv_len) });
+            root_best = res; //       
+
+            if (time_is_over())
+                break; //     
+        }
 
-        return res; //    
+        //   
+        stop_all->store(true);
+        for (auto& th : workers)
+            th.join();
+        total_nodes = nodes;
+        total_stats = stats;
+        for (const auto& helper : helpers) {
+            total_nodes += helper.nodes;
+            total_stats += helper.stats;
+        }
+
+        return res; //   
+    }
+
+    //  ,       
+    size_t searched_nodes() const
+    {
+        return total_nodes;
+    }
+
+    //     ,  ,   ,   
+    void set_seed(const unsigned seed)
+    {
+        rand_eng.seed(seed);
+    }
+
+    //  O2      
+    const search_stats& pruning_stats() const
+    {
+        return total_stats;
+    }
+
+    //     :      
+    const vector<search_iteration>& last_iterations() const
+    {
+        return iterations;
     }
 
 
 
 private:
-    //        
-    vector<vector<POS_T>> make_turn(vector<vector<POS_T>> mtx, move_pos turn) const
+    //      
+    void start_search(const Position& pos, const bool color)
     {
-        if (turn.xb != -1)
-            mtx[turn.xb][turn.yb] = 0;
-        if ((mtx[turn.x][turn.y] == 1 && turn.x2 == 0) || (mtx[turn.x][turn.y] == 2 && turn.x2 == 7))
-            mtx[turn.x][turn.y] += 2;
-        mtx[turn.x2][turn.y2] = mtx[turn.x][turn.y];
-        mtx[turn.x][turn.y] = 0;
-        return mtx;
+        bot_color = color; //      
+        hash_key = zobrist_hash(pos); //     make_move / unmake_move
+        counters.init(pos); //   
+        clear_heuristics(); //     ,  
+        root_best = full_move();
+        stop_search = false;
+        nodes = 0;
+        stats = search_stats();
     }
-    //     ,     
-    double calc_score(const vector<vector<POS_T>>& mtx, const bool first_bot_color) const
+
+    //   Logic   ,        .
+    //    ,   ,     ( 
+    //     ),      
+    void prepare_helpers()
     {
-        // color - who is max player
-    // color -   
-        double w = 0, wq = 0, b = 0, bq = 0; //      
-        for (POS_T i = 0; i < 8; ++i)
+        if (helpers.size() != threads - 1)
         {
-            for (POS_T j = 0; j < 8; ++j)
+            helpers.clear();
+            const Logic helper = *this;
+            for (unsigned i = 1; i < threads; ++i)
             {
-                w += (mtx[i][j] == 1);
-                wq += (mtx[i][j] == 3);
-                b += (mtx[i][j] == 2);
-                bq += (mtx[i][j] == 4);
-                if (scoring_mode == "NumberAndPotential")
-                {
-                    w += 0.05 * (mtx[i][j] == 1) * (7 - i);
-                    b += 0.05 * (mtx[i][j] == 2) * (i);
-                }
+                helpers.push_back(helper);
+                helpers.back().rand_eng.seed(i); //        
+                helpers.back().no_random = false;
             }
         }
-        if (!first_bot_color)
+        for (auto& helper : helpers)
         {
-            swap(b, w);
-            swap(bq, wq);
+            helper.Max_depth = Max_depth;
+            helper.scoring = scoring;
+            helper.opt_level = opt_level;
+            helper.pruning = pruning;
+            helper.max_think_ms = max_think_ms;
+            helper.cache_min_depth = cache_min_depth;
+            helper.cache_salt = cache_salt;
         }
-        if (w + wq == 0)
-            return INF;
-        if (b + bq == 0)
-            return 0;
-        int q_coef = 4; //   
+    }
 
-        if (scoring_mode == "NumberAndPotential")
+    //    :   ,    ,   
+    //    ;       
+    void helper_search(Position pos, const bool color, const int id)
+    {
+        start_search(pos, color);
+        max_think_ms = 0; //      stop_all
+        for (int depth = id % 2; depth <= Max_depth && !stop_search; ++depth)
         {
-            q_coef = 5;
+            depth_limit = depth;
+            search_root(pos, color);
         }
-        return (b + bq * q_coef) / (w + wq * q_coef);
     }
 
-    double find_first_best_turn(vector<vector<POS_T>> mtx, const bool color, const POS_T x, const POS_T y, size_t state,
-        double alpha = -1)
+    //        (apply_move),   hash_key   
+    //    
+    void make_move(Position& pos, const full_move& turn, move_undo& undo)
     {
-        //  ,   
-        if (state == 0) {
-            next_best_state.clear();
-            next_move.clear();
+        undo.key = hash_key;
+        for (uint32_t rest = turn.beaten; rest; rest &= rest - 1)
+        {
+            const POS_T s = lowest_bit(rest);
+            hash_key ^= zobrist_piece(s, pos.at(s));
         }
+        hash_key ^= zobrist_piece(turn.from, pos.at(turn.from));
+        apply_move(pos, turn, undo);
+        hash_key ^= zobrist_piece(turn.to, pos.at(turn.to));
+        counters.update(undo, ((pos.kings >> turn.to) & 1) && !undo.promoted, 1);
+    }
 
-        next_best_state.push_back(-1);
-        next_move.emplace_back(-1, -1, -1, -1); //   ,    
-
-        double best_score = -INF; //        
+    //    ,  make_move
+    void unmake_move(Position& pos, const move_undo& undo)
+    {
+        counters.update(undo, ((pos.kings >> undo.to) & 1) && !undo.promoted, -1);
+        revert_move(pos, undo);
+        hash_key = undo.key;
+    }
+    //   depth_limit:  O1         ,
+    //             
+    int aspiration_search(Position& pos, const bool color)
+    {
+        if (opt_level == Optimization::O0 || iterations.empty() || is_mate_score(iterations.back().score))
+            return search_root(pos, color);
+        const int prev = iterations.back().score;
+        int delta = ASPIRATION_WINDOW;
+        int alpha = max(prev - delta, -INF), beta = min(prev + delta, INF);
+        while (true)
+        {
+            const int score = search_root(pos, color, alpha, beta);
+            if (stop_search)
+                return score;
+            if (score <= alpha && alpha > -INF)
+                alpha = max(score - delta, -INF); //   :     alpha,  
+            else if (score >= beta && beta < INF)
+                beta = min(score + delta, INF); //   :     
+            else
+                return score;
+            delta *= 2;
+            if (delta > 8 * ASPIRATION_WINDOW)
+                alpha = -INF, beta = INF; //    -   
+        }
+    }
 
-        //      
-        find_turns(x, y, mtx);
-        auto turns_now = turns;
-        bool have_beats_now = have_beats;
+    //        Bot.BotScoringType
+    int search_root(Position& pos, const bool color, const int alpha = -INF, const int beta = INF)
+    {
+        if (scoring == Scoring::NumberAndPotential)
+            return find_first_best_turn<NumberAndPotential>(pos, color, alpha, beta);
+        return find_first_best_turn<NumberOnly>(pos, color, alpha, beta);
+    }
 
-        //       ,     
-        if (turns_now.empty()) {
-            return calc_score(mtx, color);
-        }
+    //   :        best_turn, Eval -   
+    //    (alpha, beta) -  :   alpha    beta
+    template <class Eval> int find_first_best_turn(Position& pos, const bool color, int alpha = -INF,
+        const int beta = INF)
+    {
+        best_turn = full_move(); //  ,    
+        int best_score = -INF; //   ,  
 
-        //    
-        for (auto turn : turns_now) {
-            size_t next_state = next_move.size(); //    
-            double score;
+        //       0,   -  
+        search_frame& frame = frames[0];
+        frame.pv_len = 0;
+        move_list& turns_now = frame.turns;
+        find_all_turns(pos, turns_now);
 
-            //      
-            vector<vector<POS_T>> new_mtx = make_turn(mtx, turn);
+        //    ,     ;     
+        if (!no_random)
+            shuffle(turns_now.begin(), turns_now.end(), rand_eng);
+        order_turns(turns_now, pos, color, packed_move(root_best), 0);
 
-            //   ,      
-            if (have_beats_now) {
-                score = find_first_best_turn(new_mtx, color, turn.x2, turn.y2, next_state);
-            }
-            else {
-                //     
-                score = -find_first_best_turn(new_mtx, !color, 0, -1, next_state);
-            }
+        //    
+        for (const auto& turn : turns_now) {
+            //    ,    
+            make_move(pos, turn, frame.undo);
+            //  ,   
+            const int score = search_child<Eval>(pos, color, 1, int(depth_limit), max(alpha, best_score), beta,
+                &turn == turns_now.begin());
+            unmake_move(pos, frame.undo);
+            if (stop_search)
+                return best_score; //     
 
             //   ,   
             if (score > best_score) {
                 best_score = score;
-                next_best_state[state] = next_state; //  ,     
-                next_move[state] = turn; //    
-            }
-
-            // -  -   
-            if (alpha != -1 && best_score >= alpha) {
-                break; //     ,   
+                best_turn = turn;
+                update_pv(0, turn);
             }
+            if (best_score >= beta)
+                break; //  ,    
         }
 
-        return best_score; //      
+        return best_score; //   
     }
 
-    double find_best_turns_rec(vector<vector<POS_T>> mtx, const bool color, const size_t depth,
-        double alpha = -INF, double beta = INF, const POS_T x = -1, const POS_T y = -1)
+    //   - , ply -      , remaining -  
+    //   ,  ;   -  
+    template <class Eval> int find_best_turns_rec(Position& pos, const bool color, const int ply, const int remaining,
+        int alpha = -INF, int beta = INF)
     {
-        //    (,      )
-        if (depth == 0) {
-            return calc_score(mtx, color); //    
+        //     -    
+        if (remaining <= 0 || ply >= MAX_PLY)
+            return quiescence<Eval>(pos, color, ply, alpha, beta);
+
+        //      ,    
+        if ((++nodes & 1023) == 0 && (time_is_over() || stop_all->load(memory_order_relaxed)))
+            stop_search = true;
+        if (stop_search)
+            return 0;
+        search_frame& frame = frames[ply]; //     
+        frame.pv_len = 0;
+        int tb_score;
+        if (probe_tablebase(pos, color, ply, tb_score))
+            return tb_score;
+
+        //      
+        const int alpha_orig = alpha, beta_orig = beta;
+        const uint64_t key = hash_key ^ zobrist_side(color) ^ zobrist_bot(bot_color);
+        packed_move hash_move; //    ,  
+        tt_entry entry;
+        bool found = tt->probe(key, entry);
+        //   -    ,        
+        if (cache && remaining >= cache_min_depth && (!found || entry.depth < remaining)) {
+            tt_entry cached;
+            if (cache->probe(key ^ cache_salt, cached) && (!found || cached.depth > entry.depth)) {
+                entry = cached;
+                found = true;
+                ++stats.cache;
+            }
         }
-
-        bool have_moves = false; //   ,    
-        double best_score;
-
-        //   
-        find_turns(x, y, mtx); // ,   `find_turns`      `turns`
-
-        if (turns.empty()) {
-            return calc_score(mtx, color); //    ,  
+        if (found)
+            hash_move = entry.move;
+        if (found && entry.depth >= remaining) {
+            const int score = score_from_tt(entry.score, ply);
+            if (entry.bound == Bound::EXACT)
+                return score;
+            if (entry.bound == Bound::LOWER)
+                alpha = std::max(alpha, score);
+            else
+                beta = std::min(beta, score);
+            if (beta <= alpha)
+                return score;
         }
 
-        if (color) {
-            best_score = -INF; //    
-            for (const auto& turn : turns) {
-                have_moves = true; //  
-                vector<vector<POS_T>> new_mtx = make_turn(mtx, turn); //      
-                double score = find_best_turns_rec(new_mtx, !color, depth - 1, alpha, beta, turn.x2, turn.y2); //     
-
-                best_score = std::max(best_score, score); //   
-                alpha = std::max(alpha, best_score); //  
+        const bool maximize = (color == bot_color);
+        // O2:    ,         .
+        // ProbCut         ,     
+        const bool selective = opt_level == Optimization::O2 && beta - alpha <= 1 && !is_mate_score(alpha) &&
+            !is_mate_score(beta);
+        int cut_score;
+        if (selective && probcut<Eval>(pos, color, ply, remaining, alpha, beta, cut_score))
+            return cut_score;
+
+        //       
+        move_list& turns_now = frame.turns;
+        find_all_turns(pos, turns_now);
+        order_turns(turns_now, pos, color, hash_move, ply); //     
+
+        //   -  ,   ;   ,   
+        if (turns_now.empty()) {
+            return (color == bot_color ? -mate_in(ply) : mate_in(ply));
+        }
 
-                if (beta <= alpha) { // --
-                    break; // ,     
+        if (selective && futility_cut<Eval>(maximize, remaining, turns_now.have_beats, alpha, beta, cut_score))
+            return cut_score;
+
+        int min_score = INF; //     
+        int max_score = -INF; //     
+        packed_move best_move; //     
+        for (int i = 0; i < turns_now.size(); ++i) {
+            const full_move& turn = turns_now[i];
+            move_undo& undo = frame.undo;
+            make_move(pos, turn, undo); //    ,    
+            int score;
+            // O2:           
+            if (selective && i >= pruning.lmr_moves && remaining >= pruning.lmr_min_depth && !turn.beaten) {
+                ++stats.lmr;
+                const int reduced = max(remaining - 1 - pruning.lmr_reduction, 0);
+                score = (maximize ? find_best_turns_rec<Eval>(pos, !color, ply + 1, reduced, alpha, alpha + 1)
+                                  : find_best_turns_rec<Eval>(pos, !color, ply + 1, reduced, beta - 1, beta));
+                //     -     
+                if (maximize ? score > alpha : score < beta) {
+                    ++stats.lmr_research;
+                    score = search_child<Eval>(pos, color, ply + 1, remaining - 1, alpha, beta, false);
                 }
             }
-        }
-        else {
-            best_score = INF; //    
-            for (const auto& turn : turns) {
-                have_moves = true; //  
-                vector<vector<POS_T>> new_mtx = make_turn(mtx, turn); //      
-                double score = find_best_turns_rec(new_mtx, !color, depth - 1, alpha, beta, turn.x2, turn.y2); //     
-
-                best_score = std::min(best_score, score); //   
-                beta = std::min(beta, best_score); //  
+            else
+                score = search_child<Eval>(pos, color, ply + 1, remaining - 1, alpha, beta, i == 0);
+            unmake_move(pos, undo); //  
 
-                if (beta <= alpha) { // --
-                    break; // ,     
-                }
+            if (maximize ? score > max_score : score < min_score) {
+                best_move = packed_move(turn);
+                update_pv(ply, turn);
+            }
+            min_score = std::min(min_score, score); //   
+            max_score = std::max(max_score, score);
+            if (maximize)
+                alpha = std::max(alpha, max_score); //  
+            else
+                beta = std::min(beta, min_score); //  
+
+            if (beta <= alpha) { // --
+                if (!turn.beaten)
+                    update_heuristics(turn, color, ply, remaining); //    
+                break; // ,     
             }
         }
 
+        const int best_score = (maximize ? max_score : min_score);
+
+        //    ,     
+        if (!stop_search) {
+            Bound bound = Bound::EXACT;
+            if (best_score <= alpha_orig)
+                bound = Bound::UPPER;
+            else if (best_score >= beta_orig)
+                bound = Bound::LOWER;
+            tt->store(key, remaining, bound, score_to_tt(best_score, ply), best_move);
+            if (cache && remaining >= cache_min_depth)
+                cache->store(key ^ cache_salt, remaining, bound, score_to_tt(best_score, ply), best_move);
+        }
+
         return best_score; //      
     }
 
-
-public:
-    //         ()
-    void find_turns(const bool color)
+    //    :     ,    ,  
+    //    .     "  " (stand pat)  
+    //   ;    ,  ,    
+    template <class Eval> int quiescence(Position& pos, const bool color, const int ply, int alpha, int beta)
     {
-        //    find_turns,      
-        find_turns(color, board->get_board());
+        //       
+        if ((++nodes & 1023) == 0 && (time_is_over() || stop_all->load(memory_order_relaxed)))
+            stop_search = true;
+        if (stop_search)
+            return 0;
+        frames[ply].pv_len = 0; //      
+        if (!counters.men[color] && !counters.kings[color])
+            return (color == bot_color ? -mate_in(ply) : mate_in(ply)); //    - 
+        int tb_score;
+        if (probe_tablebase(pos, color, ply, tb_score))
+            return tb_score;
+        if (ply >= MAX_PLY)
+            return Eval::score(counters, bot_color); //  
+
+        search_frame& frame = frames[ply];
+        move_list& beats = frame.turns;
+        find_beats(pos, beats);
+        if (beats.empty())
+            return Eval::score(counters, bot_color); //      
+        order_turns(beats, pos, color, packed_move(), ply); //      - 
+
+        const bool maximize = (color == bot_color);
+        int best_score = (maximize ? -INF : INF);
+        for (const auto& turn : beats) {
+            make_move(pos, turn, frame.undo);
+            const int score = quiescence<Eval>(pos, !color, ply + 1, alpha, beta);
+            unmake_move(pos, frame.undo);
+            if (maximize) {
+                best_score = max(best_score, score);
+                alpha = max(alpha, best_score);
+            }
+            else {
+                best_score = min(best_score, score);
+                beta = min(beta, best_score);
+            }
+            if (beta <= alpha)
+                break;
+        }
+        return best_score;
     }
 
-    //         (x, y)
-    void find_turns(const POS_T x, const POS_T y)
+    //      color.  O1   -     (PVS):
+    //     ,      ,    ;
+    //    ,      
+    template <class Eval> int search_child(Position& pos, const bool color, const int ply, const int remaining,
+        const int alpha, const int beta, const bool first)
     {
-        //    find_turns       
-        find_turns(x, y, board->get_board());
+        if (first || opt_level == Optimization::O0 || beta - alpha <= 1)
+            return find_best_turns_rec<Eval>(pos, !color, ply, remaining, alpha, beta);
+        int score;
+        if (color == bot_color) {
+            //     alpha
+            score = find_best_turns_rec<Eval>(pos, !color, ply, remaining, alpha, alpha + 1);
+            if (score > alpha && score < beta)
+                score = find_best_turns_rec<Eval>(pos, !color, ply, remaining, alpha, beta);
+        }
+        else {
+            //     beta
+            score = find_best_turns_rec<Eval>(pos, !color, ply, remaining, beta - 1, beta);
+            if (score < beta && score > alpha)
+                score = find_best_turns_rec<Eval>(pos, !color, ply, remaining, alpha, beta);
+        }
+        return score;
     }
 
+    // O2,    (futility):          ,
+    //     .     
+    template <class Eval> bool futility_cut(const bool maximize, const int remaining, const bool have_beats,
+        const int alpha, const int beta, int& score)
+    {
+        if (remaining > pruning.futility_depth || have_beats)
+            return false;
+        const int static_score = Eval::score(counters, bot_color);
+        const int margin = pruning.futility_margin * remaining;
+        if (maximize ? static_score + margin > alpha : static_score - margin < beta)
+            return false;
+        ++stats.futility;
+        score = (maximize ? static_score + margin : static_score - margin);
+        return true;
+    }
 
-private:
-    //            
-    void find_turns(const bool color, const vector<vector<POS_T>>& mtx)
+    // O2, ProbCut:       ,     ;   
+    //   ,      
+    template <class Eval> bool probcut(Position& pos, const bool color, const int ply, const int remaining,
+        const int alpha, const int beta, int& score)
     {
-        vector<move_pos> res_turns; //     
-        bool have_beats_before = false; // , ,    
+        if (remaining < pruning.probcut_depth)
+            return false;
+        ++stats.probcut;
+        const int shallow = remaining - pruning.probcut_reduction;
+        if (color == bot_color) {
+            const int bound = min(beta + pruning.probcut_margin, MATE_BOUND);
+            if (find_best_turns_rec<Eval>(pos, color, ply, shallow, bound - 1, bound) < bound)
+                return false;
+            score = beta;
+        }
+        else {
+            const int bound = max(alpha - pruning.probcut_margin, -MATE_BOUND);
+            if (find_best_turns_rec<Eval>(pos, color, ply, shallow, bound, bound + 1) > bound)
+                return false;
+            score = alpha;
+        }
+        if (stop_search)
+            return false; //     ,     
+        ++stats.probcut_cuts;
+        return true;
+    }
 
-        //     
-        for (POS_T i = 0; i < 8; ++i)
+    //     ply   , false -  ,   .
+    //   n       ply + n
+    bool probe_tablebase(const Position& pos, const bool color, const int ply, int& score)
+    {
+        if (!tablebase || counters.men[0] + counters.men[1] + counters.kings[0] + counters.kings[1] >
+                tablebase->max_pieces())
+            return false;
+        int value;
+        if (!tablebase->probe(pos, value))
+            return false;
+        ++stats.tablebase;
+        if (value == 0)
+            score = 0; // 
+        else
         {
-            for (POS_T j = 0; j < 8; ++j)
-            {
-                //          
-                if (mtx[i][j] && mtx[i][j] % 2 != color)
-                {
-                    //      
-                    find_turns(i, j, mtx);
-                    // ,   
-                    if (have_beats && !have_beats_before)
-                    {
-                        have_beats_before = true; //  ,   
-                        res_turns.clear(); //   ,    
-                    }
-                    //          
-                    if ((have_beats_before && have_beats) || !have_beats_before)
-                    {
-                        //      
-                        res_turns.insert(res_turns.end(), turns.begin(), turns.end());
-                    }
-                }
-            }
+            const int end = mate_in(ply + value - 1);
+            score = (tb_is_win(value) == (color == bot_color) ? end : -end);
         }
+        return true;
+    }
 
-        turns = res_turns; //   
-        shuffle(turns.begin(), turns.end(), rand_eng); //    
-        have_beats = have_beats_before; //    
+    //      :       ( ,
+    //   ), false -    
+    bool tablebase_root(Position& pos, const bool color, full_move& best, int& best_score)
+    {
+        if (!tablebase || bit_count(pos.white | pos.black) > tablebase->max_pieces())
+            return false;
+        move_list& turns_now = frames[0].turns;
+        find_all_turns(pos, turns_now);
+        if (turns_now.empty())
+            return false;
+        if (!no_random)
+            shuffle(turns_now.begin(), turns_now.end(), rand_eng); //    - 
+        best_score = -INF;
+        for (const auto& turn : turns_now) {
+            make_move(pos, turn, frames[0].undo);
+            int score = 0;
+            bool found = true;
+            if (!counters.men[!color] && !counters.kings[!color])
+                score = mate_in(1); //    
+            else
+                found = probe_tablebase(pos, !color, 1, score);
+            unmake_move(pos, frames[0].undo);
+            if (!found)
+                return false;
+            if (score > best_score) {
+                best_score = score;
+                best = turn;
+            }
+        }
+        return true;
     }
 
+    //        ,    :       
+    static int score_to_tt(const int score, const int ply)
+    {
+        if (!is_mate_score(score))
+            return score;
+        return score > 0 ? score + ply : score - ply;
+    }
 
-    //         (x, y)
-    void find_turns(const POS_T x, const POS_T y, const vector<vector<POS_T>>& mtx)
+    //          ply
+    static int score_from_tt(const int score, const int ply)
     {
-        turns.clear(); //    
-        have_beats = false; //    
-        POS_T type = mtx[x][y]; //      
+        if (!is_mate_score(score))
+            return score;
+        return score > 0 ? score - ply : score + ply;
+    }
 
-        //   
-        switch (type)
+    //    :    ,  (    - ),
+    // -  ,    
+    void order_turns(move_list& turns_now, const Position& pos, const bool color, const packed_move hash_move,
+        const int ply) const
+    {
+        auto turn_score = [&](const full_move& turn) {
+            const packed_move packed(turn); //    -   
+            if (packed == hash_move)
+                return 1 << 30;
+            if (turn.beaten) //   
+                return (1 << 29) + bit_count(turn.beaten) * 4 + bit_count(turn.beaten & pos.kings) * 2 + turn.promote;
+            if (packed == frames[ply].killers[0])
+                return 1 << 28;
+            if (packed == frames[ply].killers[1])
+                return 1 << 27;
+            return history[color][turn.from][turn.to];
+        };
+        stable_sort(turns_now.begin(), turns_now.end(),
+            [&](const full_move& a, const full_move& b) { return turn_score(a) > turn_score(b); });
+    }
 
+    //   ,  : -    
+    void update_heuristics(const full_move& turn, const bool color, const int ply, const int remaining)
+    {
+        packed_move* killers = frames[ply].killers;
+        const packed_move packed(turn);
+        if (packed != killers[0]) {
+            killers[1] = killers[0];
+            killers[0] = packed;
+        }
+        int& h = history[color][turn.from][turn.to];
+        h = std::min(h + remaining * remaining, 1 << 26); //     
+    }
 
-        {
-        case 1: //   
-        case 2: //   
-            //      
-            for (POS_T i = x - 2; i <= x + 2; i += 4) //   
-            {
-                for (POS_T j = y - 2; j <= y + 2; j += 4) //   
-                {
-                    //      
-                    if (i < 0 || i > 7 || j < 0 || j > 7)
-                        continue;
-
-                    //    
-                    POS_T xb = (x + i) / 2, yb = (y + j) / 2;
-                    // ,      
-                    if (mtx[i][j] || !mtx[xb][yb] || mtx[xb][yb] % 2 == type % 2)
-                        continue; // ,    
-
-                    //     
-                    turns.emplace_back(x, y, i, j, xb, yb);
-                }
-            }
+    //        
+    void clear_heuristics()
+    {
+        for (auto& frame : frames)
+            frame.killers[0] = frame.killers[1] = packed_move();
+        for (auto& by_color : history)
+            for (auto& by_from : by_color)
+                for (int& h : by_from)
+                    h /= 2;
+    }
 
-            break;
-        default:
-            //     
-            for (POS_T i = -1; i <= 1; i += 2) //   
-            {
-                for (POS_T j = -1; j <= 1; j += 2)
-                {
-                    POS_T xb = -1, yb = -1; //     
-                    //       
-                    for (POS_T i2 = x + i, j2 = y + j; i2 != 8 && j2 != 8 && i2 != -1 && j2 != -1; i2 += i, j2 += j)
-                    {
-                        if (mtx[i2][j2]) //   
-                        {
-                            // ,    
-                            if (mtx[i2][j2] % 2 == type % 2 || (mtx[i2][j2] % 2 != type % 2 && xb != -1))
-                            {
-                                break; //             
-                            }
-                            xb = i2; //    
-                            yb = j2; //    
-                        }
-                        if (xb != -1 && xb != i2) //     
-                        {
-                            //     
-                            turns.emplace_back(x, y, i2, j2, xb, yb);
-                        }
-                    }
-                }
-            }
-            break;
-        }
-        //     
-        if (!turns.empty()) //      
-        {
-            have_beats = true; //  ,    
-            return; //   ,    
-        }
+    //  turn     ply:    -      
+    void update_pv(const int ply, const full_move& turn)
+    {
+        search_frame& frame = frames[ply];
+        const search_frame& next = frames[ply + 1];
+        frame.pv[0] = turn;
+        copy(next.pv, next.pv + next.pv_len, frame.pv + 1);
+        frame.pv_len = next.pv_len + 1;
+    }
 
-        //        
-        switch (type)
-        {
-        case 1: //   
-        case 2: //   
-            //      
-        {
-            //       
-            POS_T i = ((type % 2) ? x - 1 : x + 1); //   x   
-            for (POS_T j = y - 1; j <= y + 1; j += 2) //     
-            {
-                //      
-                if (i < 0 || i > 7 || j < 0 || j > 7 || mtx[i][j])
-                    continue; // ,        
-                //     
-                turns.emplace_back(x, y, i, j); //     
-            }
-            break; //      
-        }
-        default:
-            //     
-            //    ,  
-            for (POS_T i = -1; i <= 1; i += 2) //    (-  -)
-            {
-                for (POS_T j = -1; j <= 1; j += 2) //    (-  -)
-                {
-                    //       
-                    for (POS_T i2 = x + i, j2 = y + j; i2 != 8 && j2 != 8 && i2 != -1 && j2 != -1; i2 += i, j2 += j)
-                    {
-                        if (mtx[i2][j2]) //      
-                            break; //  ,     
-                        //        
-                        turns.emplace_back(x, y, i2, j2); //    
-                    }
-                }
-            }
-            break; //      
-        }
+    // ,      (Bot.MaxThinkMS = 0 -  )
+    bool time_is_over() const
+    {
+        //      ,     
+        if (max_think_ms <= 0 || depth_limit == 0)
+            return false;
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start_time).count() >= max_think_ms;
     }
 
+
 public:
-    vector<move_pos> turns; //     
-    bool have_beats; // , ,   
-    int Max_depth; //     
+    int Max_depth; //      (  )
 
 private:
     default_random_engine rand_eng; //   
-    string scoring_mode; //    
-    string optimization; //  
-    vector<move_pos> next_move; //     
-    vector<int> next_best_state; //      
-    Board* board; //    
+    bool no_random; //      
+    //     Bot.BotScoringType
+    enum class Scoring
+    {
+        NumberOnly,
+        NumberAndPotential
+    };
+
+    Scoring scoring; //    
+    //  Bot.Optimization: O0 - -, O1 -        ,
+    // O2 -     
+    enum class Optimization
+    {
+        O0,
+        O1,
+        O2
+    };
+
+    Optimization opt_level; //  
+    pruning_params pruning; //   O2
+    search_stats stats; //  O2  
+    search_stats total_stats; //  O2     
+    int max_think_ms; //      
+    chrono::steady_clock::time_point start_time; //    
+    bool stop_search = false; //    
+    size_t nodes = 0; //   
+    size_t depth_limit = 0; //   
+    bool bot_color = false; // ,    
+    uint64_t hash_key = 0; //     
+    eval_counters counters; //     
+    shared_ptr<TransTable> tt; //  ,    
+    shared_ptr<const Tablebase> tablebase; //  ,     (  - )
+    shared_ptr<const OpeningBook> book; //  ,     (  - )
+    shared_ptr<SearchCache> cache; //    ,     (  - )
+    int cache_min_depth = 4; //            
+    uint64_t cache_salt = 0; //       
+    unsigned threads; //   
+    shared_ptr<atomic<bool>> stop_all; //     
+    vector<Logic> helpers; //  Logic   
+    size_t total_nodes = 0; //       
+    full_move root_best; //    
+    full_move best_turn; //    
+    //    0..MAX_PLY,   ,      
+    vector<search_frame> frames = vector<search_frame>(MAX_PLY + 1);
+    int history[2][32][32] = {}; //  : , , 
+    vector<search_iteration> iterations; //   
     Config* config; //    
 };
\ No newline at end of file
@@ -0,0 +1,200 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ,    (mmap  Linux / macOS, file mapping  Windows),      .
+//            ,    ,
+//       ,       .
+//       :      ,
+//        (SIGBUS).      
+// (create)      (replace)
+class MappedFile
+{
+public:
+    MappedFile() = default;
+
+    ~MappedFile()
+    {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    //   path   ,  false,      
+    bool open(const std::string& path)
+    {
+        return map(path, 0, false);
+    }
+
+    //    path      .      
+    bool open_writable(const std::string& path)
+    {
+        return map(path, 0, true);
+    }
+
+    //    path  size (  - )     ;
+    // false,     
+    bool create(const std::string& path, const size_t size)
+    {
+        return size > 0 && map(path, size, true);
+    }
+
+    //   to   from  : ,   ,
+    //     
+    static bool replace(const std::string& from, const std::string& to)
+    {
+#ifdef _WIN32
+        return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+        return rename(from.c_str(), to.c_str()) == 0;
+#endif
+    }
+
+    //  ,   
+    static void remove(const std::string& path)
+    {
+#ifdef _WIN32
+        DeleteFileA(path.c_str());
+#else
+        unlink(path.c_str());
+#endif
+    }
+
+    //   -   ,   ,      
+    static unsigned long process_id()
+    {
+#ifdef _WIN32
+        return GetCurrentProcessId();
+#else
+        return (unsigned long)getpid();
+#endif
+    }
+
+    //     
+    void close()
+    {
+#ifdef _WIN32
+        if (bytes)
+            UnmapViewOfFile(bytes);
+        if (mapping)
+            CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (bytes)
+            munmap(bytes, length);
+        if (fd >= 0)
+            ::close(fd);
+        fd = -1;
+#endif
+        bytes = nullptr;
+        length = 0;
+        writable = false;
+    }
+
+    bool is_open() const
+    {
+        return bytes != nullptr;
+    }
+
+    const uint8_t* data() const
+    {
+        return bytes;
+    }
+
+    //   ,   open_writable
+    uint8_t* writable_data()
+    {
+        return writable ? bytes : nullptr;
+    }
+
+    size_t size() const
+    {
+        return length;
+    }
+
+private:
+    //    :  write  size > 0     size,
+    //  write  size == 0    
+    bool map(const std::string& path, const size_t size, const bool write)
+    {
+        close();
+#ifdef _WIN32
+        file = CreateFileA(path.c_str(), write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+            FILE_SHARE_READ | (write ? FILE_SHARE_WRITE : 0), nullptr, size > 0 ? CREATE_NEW : OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER file_size;
+        if (size > 0)
+        {
+            file_size.QuadPart = LONGLONG(size);
+            if (!SetFilePointerEx(file, file_size, nullptr, FILE_BEGIN) || !SetEndOfFile(file))
+            {
+                close();
+                return false;
+            }
+        }
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+        {
+            close();
+            return false;
+        }
+        mapping = CreateFileMappingA(file, nullptr, write ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            close();
+            return false;
+        }
+        bytes = static_cast<uint8_t*>(MapViewOfFile(mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0));
+        length = size_t(file_size.QuadPart);
+#else
+        fd = ::open(path.c_str(), !write ? O_RDONLY : size > 0 ? O_RDWR | O_CREAT | O_EXCL : O_RDWR, 0644);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if ((size > 0 && ftruncate(fd, off_t(size)) != 0) || fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            close();
+            return false;
+        }
+        void* view = mmap(nullptr, size_t(st.st_size), write ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+        bytes = (view == MAP_FAILED ? nullptr : static_cast<uint8_t*>(view));
+        length = size_t(st.st_size);
+#endif
+        if (!bytes)
+        {
+            close();
+            return false;
+        }
+        writable = write;
+        return true;
+    }
+
+    uint8_t* bytes = nullptr; //  
+    size_t length = 0; //    
+    bool writable = false; //   
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+#endif
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include <chrono>
+#include <functional>
+
+#include "BoardState.h"
+#include "Logic.h"
+#include "MoveGen.h"
+
+//      :        ,   Game,   SDL,
+//        ,     
+
+//  :     
+struct match_player
+{
+    Logic* logic;
+    int level;
+};
+
+//  
+struct match_result
+{
+    int result = 0; // 0 - , 1 -  , 2 -  
+    int turns = 0; //  
+    size_t nodes[2] = { 0, 0 }; //     
+    double ms[2] = { 0, 0 }; //        
+};
+
+class Match
+{
+public:
+    //   white  black    max_turns ;      
+    Match(const match_player white, const match_player black, const int max_turns)
+        : white(white), black(black), max_turns(max_turns)
+    {
+    }
+
+    //     
+    match_result play()
+    {
+        return play(BoardState().get_position(false));
+    }
+
+    //     start (,    );    ,
+    //        ,      
+    match_result play(const Position& start)
+    {
+        match_result res;
+        board.set_position(start);
+        int turn_num = (start.color ? 0 : -1); //  
+        while (++turn_num < max_turns)
+        {
+            const bool color = turn_num % 2;
+            const Position pos = board.get_position(color);
+            move_list turns; //    
+            find_all_turns(pos, turns);
+            //    ,  
+            if (turns.empty())
+                break;
+
+            const match_player& player = (color ? black : white);
+            player.logic->Max_depth = player.level;
+            const auto turn_start = std::chrono::steady_clock::now();
+            const full_move best = player.logic->find_best_turns(pos);
+            res.ms[color] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - turn_start).count();
+            res.nodes[color] += player.logic->searched_nodes();
+            if (on_turn)
+                on_turn(pos, best, *player.logic);
+            board.make_turn(best);
+        }
+        res.turns = turn_num;
+        res.result = BoardState::result(turn_num, max_turns);
+        return res;
+    }
+
+    BoardState board; //  ,  play -     
+    //     :   ,    ,   
+    // (  -  last_iterations); ,        
+    std::function<void(const Position&, const full_move&, const Logic&)> on_turn;
+
+private:
+    match_player white, black;
+    int max_turns;
+};
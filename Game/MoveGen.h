@@ -0,0 +1,287 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "../Models/Position.h"
+#include "MoveTables.h"
+
+const int MAX_TURNS = 160; //     :  12    13     
+
+//  :  MAX_TURNS      (  ),   .
+//     (  -  ,     ),  
+//     ;    clear,        
+struct move_list
+{
+    full_move* turns = fixed; //  ,   -  
+    int count = 0; //   
+    bool have_beats = false; // , ,   - 
+
+    move_list() = default;
+
+    move_list(const move_list& other)
+    {
+        *this = other;
+    }
+
+    move_list& operator=(const move_list& other)
+    {
+        if (this == &other)
+            return *this;
+        clear();
+        for (const auto& turn : other)
+            add(turn);
+        have_beats = other.have_beats;
+        return *this;
+    }
+
+    //    
+    void add(const full_move& turn)
+    {
+        if (count == capacity)
+            grow();
+        turns[count++] = turn;
+    }
+
+    void clear()
+    {
+        count = 0;
+        have_beats = false;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    int size() const
+    {
+        return count;
+    }
+
+    full_move* begin()
+    {
+        return turns;
+    }
+
+    full_move* end()
+    {
+        return turns + count;
+    }
+
+    const full_move* begin() const
+    {
+        return turns;
+    }
+
+    const full_move* end() const
+    {
+        return turns + count;
+    }
+
+    const full_move& operator[](const int i) const
+    {
+        return turns[i];
+    }
+
+private:
+    //  :         
+    void grow()
+    {
+        if (turns == fixed)
+            more.assign(fixed, fixed + count);
+        more.resize(size_t(capacity) * 2);
+        turns = more.data();
+        capacity = int(more.size());
+    }
+
+    int capacity = MAX_TURNS; //      
+    full_move fixed[MAX_TURNS]; // ,     MAX_TURNS
+    std::vector<full_move> more; //   
+};
+
+//     :   ,    ,
+//        .
+// ,        move_tables,   
+
+//        type   s
+inline void add_piece_moves(const Position& pos, const POS_T s, const POS_T type, move_list& list)
+{
+    const move_tables& t = tables();
+    const uint32_t empty = pos.empty();
+    if (type <= 2)
+    {
+        //      :    0 ( 0, 1),    7 (2, 3)
+        for (int d = (type == 1 ? 0 : 2), end = d + 2; d < end; ++d)
+        {
+            const POS_T to = t.neighbour[s][d];
+            if (to != -1 && (empty >> to & 1))
+                list.add(full_move::quiet(s, to));
+        }
+        return;
+    }
+    //        
+    for (int d = 0; d < 4; ++d)
+    {
+        for (int i = 0; i < t.ray_len[s][d] && (empty >> t.ray[s][d][i] & 1); ++i)
+            list.add(full_move::quiet(s, t.ray[s][d][i]));
+    }
+}
+
+//      type.  work      ,  
+//  ,      .     ;
+//  all_paths   ,      -  
+inline void add_beat_series(Position& work, const POS_T type, full_move& cur, move_list& list, const bool all_paths)
+{
+    const move_tables& t = tables();
+    const POS_T s = cur.len ? cur.path[cur.len - 1] : cur.from; //     
+    const uint32_t enemy = (type % 2) ? work.black : work.white;
+    const uint32_t empty = work.empty();
+    bool can_beat = false;
+
+    //    over   to,    
+    auto beat = [&](const POS_T over, const POS_T to) {
+        can_beat = true;
+        const uint32_t bit = uint32_t(1) << over;
+        const bool over_king = (work.kings & bit) != 0;
+        const bool promote_before = cur.promote;
+        // ,    ,     
+        const bool promote_now = (type == 1 && to < 4) || (type == 2 && to >= 28);
+        work.white &= ~bit;
+        work.black &= ~bit;
+        work.kings &= ~bit;
+        cur.path[cur.len] = to;
+        cur.beaten_at[cur.len] = over;
+        cur.beaten |= bit;
+        cur.promote = promote_before || promote_now;
+        ++cur.len;
+        add_beat_series(work, promote_now ? type + 2 : type, cur, list, all_paths);
+        --cur.len;
+        cur.promote = promote_before;
+        cur.beaten &= ~bit;
+        if (type % 2)
+            work.black |= bit;
+        else
+            work.white |= bit;
+        if (over_king)
+            work.kings |= bit;
+    };
+
+    if (type <= 2)
+    {
+        //         
+        for (int d = 0; d < 4; ++d)
+        {
+            const POS_T to = t.jump[s][d];
+            if (to != -1 && (enemy >> t.neighbour[s][d] & 1) && (empty >> to & 1))
+                beat(t.neighbour[s][d], to);
+        }
+    }
+    else
+    {
+        //               
+        for (int d = 0; d < 4; ++d)
+        {
+            const POS_T* ray = t.ray[s][d];
+            const int len = t.ray_len[s][d];
+            int i = 0;
+            while (i < len && (empty >> ray[i] & 1))
+                ++i;
+            if (i == len || !(enemy >> ray[i] & 1))
+                continue; //       
+            const POS_T over = ray[i];
+            for (++i; i < len && (empty >> ray[i] & 1); ++i)
+                beat(over, ray[i]);
+        }
+    }
+
+    //    -  
+    if (can_beat || !cur.len)
+        return;
+    cur.to = s;
+    //           ,       
+    for (const auto& turn : list)
+    {
+        if (!all_paths && turn == cur)
+            return;
+    }
+    list.add(cur);
+}
+
+//           s
+inline void add_piece_series(const Position& pos, const POS_T s, move_list& list, const bool all_paths = false)
+{
+    Position work = pos;
+    const POS_T type = work.at(s);
+    work.set(s, 0); //           
+    full_move cur;
+    cur.from = s;
+    add_beat_series(work, type, cur, list, all_paths);
+}
+
+//     pos.color (    ),   -  
+inline void find_beats(const Position& pos, move_list& list, const bool all_paths = false)
+{
+    list.clear();
+    for (uint32_t rest = pos.pieces(pos.color); rest; rest &= rest - 1)
+        add_piece_series(pos, lowest_bit(rest), list, all_paths);
+    list.have_beats = !list.empty();
+}
+
+//    pos.color:      ,   .
+// all_paths -   :    ,      
+// ,     ,     
+inline void find_all_turns(const Position& pos, move_list& list, const bool all_paths = false)
+{
+    //      ,    
+    find_beats(pos, list, all_paths);
+    if (list.have_beats)
+        return;
+
+    //   -   
+    for (uint32_t rest = pos.pieces(pos.color); rest; rest &= rest - 1)
+    {
+        const POS_T s = lowest_bit(rest);
+        add_piece_moves(pos, s, pos.at(s), list);
+    }
+}
+
+
+//     ,  undo     ;     
+inline void apply_move(Position& pos, const full_move& turn, move_undo& undo)
+{
+    undo.from = turn.from;
+    undo.to = turn.to;
+    undo.color = pos.color;
+    undo.beaten = turn.beaten;
+    undo.beaten_kings = turn.beaten & pos.kings; // ,      
+    if (pos.color)
+        pos.white &= ~turn.beaten;
+    else
+        pos.black &= ~turn.beaten;
+    pos.kings &= ~turn.beaten;
+    POS_T type = pos.at(turn.from);
+    undo.promoted = type <= 2 && (turn.promote || (type == 1 && turn.to < 4) || (type == 2 && turn.to >= 28));
+    if (undo.promoted)
+        type += 2;
+    pos.set(turn.from, 0); //         
+    pos.set(turn.to, type);
+    pos.color = !pos.color;
+}
+
+//  ,  apply_move
+inline void revert_move(Position& pos, const move_undo& undo)
+{
+    POS_T type = pos.at(undo.to);
+    if (undo.promoted)
+        type -= 2; //    
+    pos.set(undo.to, 0);
+    pos.set(undo.from, type);
+    //   
+    if (undo.color)
+        pos.white |= undo.beaten;
+    else
+        pos.black |= undo.beaten;
+    pos.kings |= undo.beaten_kings;
+    pos.color = undo.color;
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+
+#include "../Models/Move.h"
+
+//  : 0, 1 -   0 (  ), 2, 3 -   7 (  )
+constexpr POS_T DIR_X[4] = { -1, -1, 1, 1 };
+constexpr POS_T DIR_Y[4] = { -1, 1, -1, 1 };
+
+//  ,       32  , -1 -    .
+//   ,          
+struct move_tables
+{
+    POS_T neighbour[32][4] = {}; //     (    )
+    POS_T jump[32][4] = {}; //      
+    POS_T ray[32][4][7] = {}; //         
+    POS_T ray_len[32][4] = {}; //  
+    uint32_t ray_mask[32][4] = {}; //   
+
+    constexpr move_tables()
+    {
+        for (int s = 0; s < 32; ++s)
+        {
+            //   ,  square_x / square_y,  constexpr
+            const int x = s / 4, y = s % 4 * 2 + (s / 4 + 1) % 2;
+            for (int d = 0; d < 4; ++d)
+            {
+                neighbour[s][d] = jump[s][d] = -1;
+                int len = 0;
+                for (int i = x + DIR_X[d], j = y + DIR_Y[d]; i >= 0 && i < 8 && j >= 0 && j < 8;
+                     i += DIR_X[d], j += DIR_Y[d])
+                {
+                    const POS_T t = POS_T(i * 4 + j / 2);
+                    ray[s][d][len++] = t;
+                    ray_mask[s][d] |= uint32_t(1) << t;
+                }
+                ray_len[s][d] = POS_T(len);
+                if (len > 0)
+                    neighbour[s][d] = ray[s][d][0];
+                if (len > 1)
+                    jump[s][d] = ray[s][d][1];
+            }
+        }
+    }
+};
+
+// ,   
+inline const move_tables& tables()
+{
+    static constexpr move_tables table;
+    return table;
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+#include <algorithm>
+#include <random>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "../Models/Move.h"
+#include "../Models/Position.h"
+#include "MappedFile.h"
+#include "MoveGen.h"
+#include "TransTable.h"
+
+//  :          (   
+//       Tools/bookgen).        
+
+const uint32_t BOOK_VERSION = 1; //   
+
+//   ,   count  book_entry,   
+struct book_file_header
+{
+    char magic[4]; // "CKOB"
+    uint32_t version; // BOOK_VERSION
+    uint64_t count; //  
+};
+
+//  :      
+struct book_entry
+{
+    uint64_t key; //   (book_key)
+    uint64_t move; //    packed_move
+    uint32_t weight; //  
+    uint32_t reserved;
+};
+
+//    :    
+inline uint64_t book_key(const Position& pos)
+{
+    return zobrist_hash(pos) ^ zobrist_side(pos.color);
+}
+
+//  ,      bookgen.  ,    
+class OpeningBook
+{
+public:
+    //   , false -      
+    bool open(const std::string& path)
+    {
+        entries = nullptr;
+        count = 0;
+        if (!file.open(path) || file.size() < sizeof(book_file_header))
+            return false;
+        book_file_header header;
+        memcpy(&header, file.data(), sizeof(header));
+        if (memcmp(header.magic, "CKOB", 4) != 0 || header.version != BOOK_VERSION ||
+            file.size() < sizeof(header) + header.count * sizeof(book_entry))
+        {
+            file.close();
+            return false;
+        }
+        //  16 ,     8    
+        entries = reinterpret_cast<const book_entry*>(file.data() + sizeof(header));
+        count = size_t(header.count);
+        return true;
+    }
+
+    //   ()  
+    size_t size() const
+    {
+        return count;
+    }
+
+    //    :  weighted -     ,    .
+    //       ,       .
+    // false -    
+    bool probe(const Position& pos, std::default_random_engine& rng, const bool weighted, full_move& move) const
+    {
+        const uint64_t key = book_key(pos);
+        const book_entry* first = std::lower_bound(entries, entries + count, key,
+            [](const book_entry& entry, const uint64_t k) { return entry.key < k; });
+        if (first == entries + count || first->key != key)
+            return false;
+        move_list turns;
+        find_all_turns(pos, turns);
+
+        //      
+        std::vector<full_move> found;
+        std::vector<uint32_t> weights;
+        uint64_t total = 0;
+        for (const book_entry* entry = first; entry != entries + count && entry->key == key; ++entry)
+        {
+            for (const auto& turn : turns)
+            {
+                if (packed_move(turn).bits == entry->move && entry->weight)
+                {
+                    found.push_back(turn);
+                    weights.push_back(entry->weight);
+                    total += entry->weight;
+                    break;
+                }
+            }
+        }
+        if (found.empty())
+            return false;
+        size_t pick = size_t(std::max_element(weights.begin(), weights.end()) - weights.begin());
+        if (weighted)
+        {
+            uint64_t r = std::uniform_int_distribution<uint64_t>(0, total - 1)(rng);
+            for (pick = 0; r >= weights[pick]; ++pick)
+                r -= weights[pick];
+        }
+        move = found[pick];
+        return true;
+    }
+
+private:
+    MappedFile file; //   
+    const book_entry* entries = nullptr; //  
+    size_t count = 0; //  
+};
@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#include "MappedFile.h"
+#include "TransTable.h"
+
+//    :   ,    ,   , 
+//    .          ,  ,
+//  ,      ,    .
+//     (64 ):       ,
+//    ,       
+
+const uint32_t CACHE_VERSION = 1; //   
+const int CACHE_BUCKET = 4; //   
+
+//   ,    tt_slot
+struct cache_file_header
+{
+    char magic[4]; // "CKSC"
+    uint32_t version; // CACHE_VERSION
+    uint64_t slots; //  
+};
+
+class SearchCache
+{
+public:
+    //          size_mb .    
+    //    ,   size_mb :      ,
+    //      .     ,    .
+    // false -      ,    
+    bool open(const std::string& path, const size_t size_mb)
+    {
+        static_assert(sizeof(tt_slot) == 16 && ATOMIC_LLONG_LOCK_FREE == 2, "slots must be plain lock-free words");
+        table = nullptr;
+        if (map_existing(path))
+            return true;
+        size_t buckets = 1;
+        while (buckets * 2 * CACHE_BUCKET * sizeof(tt_slot) + sizeof(cache_file_header) <= size_mb * 1024 * 1024)
+            buckets *= 2;
+        const size_t bytes = sizeof(cache_file_header) + buckets * CACHE_BUCKET * sizeof(tt_slot);
+        const std::string temp = path + ".tmp" + std::to_string(MappedFile::process_id());
+        MappedFile::remove(temp); //      
+        if (!file.create(temp, bytes))
+            return false;
+        //      -  ,   
+        const cache_file_header header = { { 'C', 'K', 'S', 'C' }, CACHE_VERSION, uint64_t(buckets * CACHE_BUCKET) };
+        memcpy(file.writable_data(), &header, sizeof(header));
+        file.close();
+        if (!MappedFile::replace(temp, path))
+        {
+            MappedFile::remove(temp);
+            return false;
+        }
+        //       ,  ,    
+        return map_existing(path);
+    }
+
+    //    ,  true,   
+    bool probe(const uint64_t key, tt_entry& entry) const
+    {
+        const tt_slot* bucket = table + (key & mask) * CACHE_BUCKET;
+        for (int i = 0; i < CACHE_BUCKET; ++i)
+        {
+            bucket[i].load(entry);
+            if (entry.bound != Bound::NONE && entry.key_check == uint32_t(key >> 32))
+                return true;
+        }
+        return false;
+    }
+
+    //  :     ,    ,   
+    //       ,     
+    void store(const uint64_t key, const int depth, const Bound bound, const int score, const packed_move move)
+    {
+        tt_slot* bucket = table + (key & mask) * CACHE_BUCKET;
+        tt_slot* victim = nullptr;
+        int victim_depth = depth + 1;
+        for (int i = 0; i < CACHE_BUCKET; ++i)
+        {
+            tt_entry old;
+            bucket[i].load(old);
+            if (old.bound != Bound::NONE && old.key_check == uint32_t(key >> 32))
+            {
+                victim = (depth >= old.depth ? &bucket[i] : nullptr);
+                break;
+            }
+            const int old_depth = (old.bound == Bound::NONE ? -1 : old.depth);
+            if (old_depth < victim_depth)
+            {
+                victim = &bucket[i];
+                victim_depth = old_depth;
+            }
+        }
+        if (victim)
+            victim->save(key, depth, bound, score, move, 0);
+    }
+
+private:
+    //    , false -      
+    bool map_existing(const std::string& path)
+    {
+        if (!file.open_writable(path))
+            return false;
+        cache_file_header header;
+        if (file.size() >= sizeof(header))
+            memcpy(&header, file.data(), sizeof(header));
+        const uint64_t slots = (file.size() - sizeof(header)) / sizeof(tt_slot);
+        if (file.size() < sizeof(header) + CACHE_BUCKET * sizeof(tt_slot) || memcmp(header.magic, "CKSC", 4) != 0 ||
+            header.version != CACHE_VERSION || header.slots != slots || slots % CACHE_BUCKET != 0 ||
+            ((slots / CACHE_BUCKET) & (slots / CACHE_BUCKET - 1)) != 0)
+        {
+            file.close();
+            return false;
+        }
+        //  16 ,     16    
+        table = reinterpret_cast<tt_slot*>(file.writable_data() + sizeof(header));
+        mask = size_t(slots / CACHE_BUCKET) - 1;
+        return true;
+    }
+
+    MappedFile file; //   
+    tt_slot* table = nullptr; //    
+    size_t mask = 0; //   
+};
@@ -0,0 +1,221 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#include "../Models/Position.h"
+#include "MappedFile.h"
+
+//  :             .
+//   -  : 0 - ,       + 1 (  -  );
+//   -  ,   ,  -   (1 -   ).
+//      :       (Position::flipped)
+
+const int TB_MAX_PIECES = 8; //      
+const int TB_MAX_VALUE = 254; //   ,    
+const uint32_t TB_VERSION = 1; //   
+
+//   ,    (0 - )
+inline bool tb_is_win(const int value)
+{
+    return value && value % 2 == 0;
+}
+
+//   C(n, k)  0 <= n <= 32
+inline uint64_t binomial(const int n, const int k)
+{
+    struct table_t
+    {
+        uint64_t c[33][33] = {};
+        table_t()
+        {
+            for (int i = 0; i <= 32; ++i)
+            {
+                c[i][0] = 1;
+                for (int j = 1; j <= i; ++j)
+                    c[i][j] = c[i - 1][j - 1] + c[i - 1][j];
+            }
+        }
+    };
+    static const table_t table;
+    return k < 0 || k > n ? 0 : table.c[n][k];
+}
+
+//          ( )
+inline uint64_t rank_set(const uint32_t mask)
+{
+    uint64_t rank = 0;
+    int i = 0;
+    for (uint32_t rest = mask; rest; rest &= rest - 1)
+        rank += binomial(lowest_bit(rest), ++i);
+    return rank;
+}
+
+//   k    0..n-1   
+inline uint32_t unrank_set(uint64_t rank, const int k, int n)
+{
+    uint32_t mask = 0;
+    for (int i = k; i > 0; --i)
+    {
+        int s = n - 1;
+        while (binomial(s, i) > rank)
+            --s;
+        rank -= binomial(s, i);
+        mask |= uint32_t(1) << s;
+        n = s;
+    }
+    return mask;
+}
+
+//  :           ,    .
+//            .   
+//    4..31,  -  0..27 (     ). ,  
+//    ,   -       
+struct tb_slice
+{
+    int wm = 0, wk = 0, bm = 0, bk = 0;
+
+    //     
+    static tb_slice of(const Position& pos)
+    {
+        tb_slice slice;
+        slice.wm = bit_count(pos.white & ~pos.kings);
+        slice.wk = bit_count(pos.white & pos.kings);
+        slice.bm = bit_count(pos.black & ~pos.kings);
+        slice.bk = bit_count(pos.black & pos.kings);
+        return slice;
+    }
+
+    int pieces() const
+    {
+        return wm + wk + bm + bk;
+    }
+
+    //    
+    tb_slice flipped() const
+    {
+        return { bm, bk, wm, wk };
+    }
+
+    //      [wm][wk][bm][bk]
+    int id() const
+    {
+        return ((wm * (TB_MAX_PIECES + 1) + wk) * (TB_MAX_PIECES + 1) + bm) * (TB_MAX_PIECES + 1) + bk;
+    }
+
+    //    
+    uint64_t size() const
+    {
+        return binomial(28, wm) * binomial(28, bm) * binomial(32, wk) * binomial(32, bk);
+    }
+
+    //        
+    uint64_t index(const Position& pos) const
+    {
+        uint64_t res = rank_set((pos.white & ~pos.kings) >> 4);
+        res = res * binomial(28, bm) + rank_set(pos.black & ~pos.kings);
+        res = res * binomial(32, wk) + rank_set(pos.white & pos.kings);
+        return res * binomial(32, bk) + rank_set(pos.black & pos.kings);
+    }
+
+    //   , false -    (   )
+    bool position(uint64_t index, Position& pos) const
+    {
+        const uint32_t black_kings = unrank_set(index % binomial(32, bk), bk, 32);
+        index /= binomial(32, bk);
+        const uint32_t white_kings = unrank_set(index % binomial(32, wk), wk, 32);
+        index /= binomial(32, wk);
+        const uint32_t black_men = unrank_set(index % binomial(28, bm), bm, 28);
+        index /= binomial(28, bm);
+        const uint32_t white_men = unrank_set(index, wm, 28) << 4;
+        if (bit_count(white_men | black_men | white_kings | black_kings) != pieces())
+            return false;
+        pos.white = white_men | white_kings;
+        pos.black = black_men | black_kings;
+        pos.kings = white_kings | black_kings;
+        pos.color = false;
+        return true;
+    }
+};
+
+//   ,   slices  tb_file_slice    
+struct tb_file_header
+{
+    char magic[4]; // "CKTB"
+    uint32_t version; // TB_VERSION
+    uint32_t max_pieces; //         
+    uint32_t slices; //    
+};
+
+//     
+struct tb_file_slice
+{
+    uint8_t wm, wk, bm, bk; // 
+    uint32_t reserved;
+    uint64_t offset; //      
+    uint64_t size; //   () 
+};
+
+//  ,      tbgen.  ,   
+//       
+class Tablebase
+{
+public:
+    //   , false -      
+    bool open(const std::string& path)
+    {
+        memset(data, 0, sizeof(data));
+        pieces = 0;
+        if (!file.open(path) || file.size() < sizeof(tb_file_header))
+            return false;
+        tb_file_header header;
+        memcpy(&header, file.data(), sizeof(header));
+        if (memcmp(header.magic, "CKTB", 4) != 0 || header.version != TB_VERSION ||
+            header.max_pieces > TB_MAX_PIECES ||
+            file.size() < sizeof(header) + uint64_t(header.slices) * sizeof(tb_file_slice))
+        {
+            file.close();
+            return false;
+        }
+        for (uint32_t i = 0; i < header.slices; ++i)
+        {
+            tb_file_slice entry;
+            memcpy(&entry, file.data() + sizeof(header) + i * sizeof(entry), sizeof(entry));
+            const tb_slice slice{ entry.wm, entry.wk, entry.bm, entry.bk };
+            if (slice.pieces() > int(header.max_pieces) || entry.size != slice.size() ||
+                entry.offset + entry.size > file.size())
+            {
+                file.close();
+                return false;
+            }
+            data[slice.id()] = file.data() + entry.offset;
+        }
+        pieces = int(header.max_pieces);
+        return true;
+    }
+
+    //   ,     (0 -   )
+    int max_pieces() const
+    {
+        return pieces;
+    }
+
+    //    ,   ; false -    
+    bool probe(const Position& pos, int& value) const
+    {
+        const Position norm = (pos.color ? pos.flipped() : pos);
+        if (!norm.white || !norm.black || bit_count(norm.white | norm.black) > pieces)
+            return false;
+        const tb_slice slice = tb_slice::of(norm);
+        const uint8_t* values = data[slice.id()];
+        if (!values)
+            return false;
+        value = values[slice.index(norm)];
+        return true;
+    }
+
+private:
+    MappedFile file; //   
+    int pieces = 0; //   
+    const uint8_t* data[(TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1)] = {};
+};
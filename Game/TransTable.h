@@ -0,0 +1,192 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+
+#include "../Models/Move.h"
+#include "../Models/Position.h"
+
+//  : 32  x 4  ,    ,    
+struct zobrist_keys
+{
+    uint64_t keys[32 * 4 + 2] = {};
+
+    //      splitmix64,     
+    constexpr zobrist_keys()
+    {
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        for (int i = 0; i < 32 * 4 + 2; ++i)
+        {
+            state += 0x9E3779B97F4A7C15ull;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            keys[i] = z ^ (z >> 31);
+        }
+    }
+};
+
+//  ,   
+inline const zobrist_keys& zobrist()
+{
+    static constexpr zobrist_keys table;
+    return table;
+}
+
+//    type (1..4    Board)   s
+inline uint64_t zobrist_piece(const POS_T s, const POS_T type)
+{
+    return zobrist().keys[s * 4 + type - 1];
+}
+
+//    
+inline uint64_t zobrist_side(const bool color)
+{
+    return color ? zobrist().keys[128] : 0;
+}
+
+//  ,       (  Logic    )
+inline uint64_t zobrist_bot(const bool bot_color)
+{
+    return bot_color ? zobrist().keys[129] : 0;
+}
+
+//       
+inline uint64_t zobrist_hash(const Position& pos)
+{
+    uint64_t key = 0;
+    for (uint32_t all = pos.white | pos.black; all; all &= all - 1)
+    {
+        const POS_T s = lowest_bit(all);
+        key ^= zobrist_piece(s, pos.at(s));
+    }
+    return key;
+}
+
+//  ,   
+enum class Bound : uint8_t
+{
+    //  
+    NONE,
+
+    //  
+    EXACT,
+
+    //  :     beta
+    LOWER,
+
+    //  :      alpha
+    UPPER
+};
+
+//      
+struct tt_entry
+{
+    uint32_t key_check = 0; //  32       (  )
+    int16_t score = 0; //  
+    packed_move move; //    (   ,   )
+    int8_t depth = -1; //  ,    
+    Bound bound = Bound::NONE; //  
+    uint8_t age = 0; //  ,     (6 )
+};
+
+//  , 16 : meta   meta ^ move.
+// meta:  0-5 -  , 6-7 -  , 8-15 - , 16-31 - , 32-63 -   
+// move:    packed_move.
+//   64-   ,          
+struct tt_slot
+{
+    std::atomic<uint64_t> meta;
+    std::atomic<uint64_t> move;
+
+    //    
+    void load(tt_entry& entry) const
+    {
+        const uint64_t move_bits = move.load(std::memory_order_relaxed);
+        const uint64_t meta_bits = meta.load(std::memory_order_relaxed) ^ move_bits;
+        entry.age = uint8_t(meta_bits & 63);
+        entry.bound = Bound((meta_bits >> 6) & 3);
+        entry.depth = int8_t(meta_bits >> 8);
+        entry.score = int16_t(meta_bits >> 16);
+        entry.key_check = uint32_t(meta_bits >> 32);
+        entry.move = packed_move(move_bits);
+    }
+
+    //   
+    void save(const uint64_t key, const int depth, const Bound bound, const int score, const packed_move best,
+        const uint8_t age)
+    {
+        const uint64_t move_bits = best.bits; //   - 0
+        const uint64_t meta_bits = uint64_t(key >> 32) << 32 | uint64_t(uint16_t(score)) << 16 |
+            uint64_t(uint8_t(depth)) << 8 | uint64_t(bound) << 6 | age;
+        meta.store(meta_bits ^ move_bits, std::memory_order_relaxed);
+        move.store(move_bits, std::memory_order_relaxed);
+    }
+};
+
+//         .
+//         :     
+//  xor  ,  ,      ,    
+class TransTable
+{
+public:
+    // ,     
+    TransTable(const size_t size_mb)
+    {
+        resize(size_mb);
+    }
+
+    //    :   -   ,   size_mb
+    void resize(const size_t size_mb)
+    {
+        size_t count = 1;
+        while (count * 2 * sizeof(tt_slot) <= size_mb * 1024 * 1024)
+            count *= 2;
+        table.reset(new tt_slot[count]);
+        size = count;
+        mask = count - 1;
+        clear();
+    }
+
+    //   
+    void clear()
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            table[i].meta.store(0, std::memory_order_relaxed);
+            table[i].move.store(0, std::memory_order_relaxed);
+        }
+        age = 0;
+    }
+
+    //   :       .
+    //     
+    void new_search()
+    {
+        age = (age + 1) & 63;
+    }
+
+    //    ,  true,   
+    bool probe(const uint64_t key, tt_entry& entry) const
+    {
+        table[key & mask].load(entry);
+        return entry.bound != Bound::NONE && entry.key_check == uint32_t(key >> 32);
+    }
+
+    //  :        
+    void store(const uint64_t key, const int depth, const Bound bound, const int score, const packed_move move)
+    {
+        tt_slot& slot = table[key & mask];
+        tt_entry old;
+        slot.load(old);
+        if (old.bound != Bound::NONE && old.age == age && old.key_check != uint32_t(key >> 32) && depth < old.depth)
+            return; //      
+        slot.save(key, depth, bound, score, move, age);
+    }
+
+private:
+    std::unique_ptr<tt_slot[]> table; //  
+    size_t size = 0; //  ,  
+    size_t mask = 0; //  
+    uint8_t age = 0; //    (  64)
+};
\ No newline at end of file
@@ -1,14 +1,39 @@
 #pragma once
+#include <functional>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string>
+#include <vector>
 
 typedef int8_t POS_T; //   POS_T  8-   (  )
 
+//    (0..31)   :  x,  y
+inline POS_T square_of(const POS_T x, const POS_T y)
+{
+    return x * 4 + y / 2;
+}
+
+//      
+inline POS_T square_x(const POS_T s)
+{
+    return s / 4;
+}
+
+//       (        )
+inline POS_T square_y(const POS_T s)
+{
+    return s % 4 * 2 + (s / 4 + 1) % 2;
+}
+
 struct move_pos
 {
     POS_T x, y;             //   () 
     POS_T x2, y2;           //   () 
     POS_T xb = -1, yb = -1; //    (  -1,      )
 
+    //        ,   
+    move_pos() = default;
+
     //     move_pos     
     move_pos(const POS_T x, const POS_T y, const POS_T x2, const POS_T y2) : x(x), y(y), x2(x2), y2(y2)
     {
@@ -33,4 +58,172 @@ struct move_pos
         //  true,       
         return !(*this == other);
     }
-};
\ No newline at end of file
+};
+
+const int MAX_BEATS = 12; //  12       
+
+//       (0..31):       
+struct full_move
+{
+    POS_T from = -1; // ,    
+    POS_T to = -1; // ,    
+    uint32_t beaten = 0; //    (0 -  )
+    bool promote = false; //      
+    POS_T len = 0; //      (0 -  )
+    POS_T path[MAX_BEATS]; // ,       
+    POS_T beaten_at[MAX_BEATS]; //  ,   
+
+    //  ,    : , ,    
+    bool operator==(const full_move& other) const
+    {
+        return from == other.from && to == other.to && beaten == other.beaten && promote == other.promote;
+    }
+
+    bool operator!=(const full_move& other) const
+    {
+        return !(*this == other);
+    }
+
+    //   from -> to
+    static full_move quiet(const POS_T from, const POS_T to)
+    {
+        full_move turn;
+        turn.from = from;
+        turn.to = to;
+        return turn;
+    }
+
+    //     :   -  ,   -    
+    int step_count() const
+    {
+        return len ? len : 1;
+    }
+
+    //   k   move_pos  Board (  ,   )
+    move_pos step(const int k) const
+    {
+        if (len == 0)
+            return move_pos(square_x(from), square_y(from), square_x(to), square_y(to));
+        const POS_T cur = k ? path[k - 1] : from;
+        return move_pos(square_x(cur), square_y(cur), square_x(path[k]), square_y(path[k]),
+            square_x(beaten_at[k]), square_y(beaten_at[k]));
+    }
+
+    //     :  a-h,  1-8  ( 0  - ),
+    //   "c3-d4",       "c3:e5:g3"
+    std::string notation() const
+    {
+        auto square_name = [](const POS_T s) {
+            return std::string(1, char('a' + square_y(s))) + char('8' - square_x(s));
+        };
+        if (from == -1)
+            return "-";
+        if (len == 0)
+            return square_name(from) + "-" + square_name(to);
+        std::string res = square_name(from);
+        for (POS_T i = 0; i < len; ++i)
+            res += ":" + square_name(path[i]);
+        return res;
+    }
+
+    //        
+    std::vector<move_pos> steps() const
+    {
+        std::vector<move_pos> res;
+        for (int k = 0; k < step_count(); ++k)
+            res.push_back(step(k));
+        return res;
+    }
+};
+
+//     64- :  0-31 -   , 32-36 - , 37-41 - ,
+// 42 - .    full_move (   ),    -  .
+// 0 -  :     ,        
+struct packed_move
+{
+    uint64_t bits = 0;
+
+    packed_move() = default;
+
+    explicit packed_move(const uint64_t bits) : bits(bits)
+    {
+    }
+
+    //    ( full_move -  )
+    explicit packed_move(const full_move& turn)
+        : bits(turn.from < 0 ? 0
+                             : uint64_t(turn.beaten) | uint64_t(turn.from) << 32 | uint64_t(turn.to) << 37 |
+                                   uint64_t(turn.promote) << 42)
+    {
+    }
+
+    //    :      (   )
+    explicit packed_move(const move_pos& step)
+        : bits(uint64_t(step.xb != -1 ? uint32_t(1) << square_of(step.xb, step.yb) : 0) |
+              uint64_t(square_of(step.x, step.y)) << 32 | uint64_t(square_of(step.x2, step.y2)) << 37)
+    {
+    }
+
+    bool empty() const
+    {
+        return bits == 0;
+    }
+
+    POS_T from() const
+    {
+        return POS_T(bits >> 32 & 31);
+    }
+
+    POS_T to() const
+    {
+        return POS_T(bits >> 37 & 31);
+    }
+
+    uint32_t beaten() const
+    {
+        return uint32_t(bits);
+    }
+
+    bool promote() const
+    {
+        return (bits >> 42) & 1;
+    }
+
+    //   : ,    ,     
+    move_pos to_move_pos() const
+    {
+        move_pos res(square_x(from()), square_y(from()), square_x(to()), square_y(to()));
+        const uint32_t mask = beaten();
+        if (mask && !(mask & (mask - 1)))
+        {
+            POS_T s = 0;
+            while (!(mask >> s & 1))
+                ++s;
+            res.xb = square_x(s);
+            res.yb = square_y(s);
+        }
+        return res;
+    }
+
+    bool operator==(const packed_move& other) const
+    {
+        return bits == other.bits;
+    }
+
+    bool operator!=(const packed_move& other) const
+    {
+        return bits != other.bits;
+    }
+};
+
+//      
+namespace std
+{
+template <> struct hash<packed_move>
+{
+    size_t operator()(const packed_move& move) const
+    {
+        return size_t(move.bits * 0x9E3779B97F4A7C15ULL >> 16);
+    }
+};
+} // namespace std
@@ -0,0 +1,168 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "Move.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+//    
+inline int bit_count(const uint32_t mask)
+{
+#ifdef _MSC_VER
+    return __popcnt(mask);
+#else
+    return __builtin_popcount(mask);
+#endif
+}
+
+//      (    )
+inline int lowest_bit(const uint32_t mask)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+//     :  s   31 - s (   180 )
+inline uint32_t reverse_bits(uint32_t mask)
+{
+    mask = (mask >> 1 & 0x55555555) | (mask & 0x55555555) << 1;
+    mask = (mask >> 2 & 0x33333333) | (mask & 0x33333333) << 2;
+    mask = (mask >> 4 & 0x0F0F0F0F) | (mask & 0x0F0F0F0F) << 4;
+    mask = (mask >> 8 & 0x00FF00FF) | (mask & 0x00FF00FF) << 8;
+    return mask >> 16 | mask << 16;
+}
+
+//  :       32  
+struct Position
+{
+    uint32_t white = 0; //   (  )
+    uint32_t black = 0; //   (  )
+    uint32_t kings = 0; //   
+    bool color = false; //  : false - , true - 
+
+    //   
+    uint32_t empty() const
+    {
+        return ~(white | black);
+    }
+
+    //    
+    uint32_t pieces(const bool col) const
+    {
+        return col ? black : white;
+    }
+
+    //        Board:
+    // 0 - , 1 -  , 2 -  , 3 -  , 4 -  
+    POS_T at(const POS_T s) const
+    {
+        const uint32_t bit = uint32_t(1) << s;
+        if (!((white | black) & bit))
+            return 0;
+        return ((black & bit) ? 2 : 1) + ((kings & bit) ? 2 : 0);
+    }
+
+    //     
+    POS_T at(const POS_T x, const POS_T y) const
+    {
+        return at(square_of(x, y));
+    }
+
+    //       (0 -  )
+    void set(const POS_T s, const POS_T type)
+    {
+        const uint32_t bit = uint32_t(1) << s;
+        white &= ~bit;
+        black &= ~bit;
+        kings &= ~bit;
+        if (!type)
+            return;
+        if (type % 2)
+            white |= bit;
+        else
+            black |= bit;
+        if (type > 2)
+            kings |= bit;
+    }
+
+    bool operator==(const Position& other) const
+    {
+        return white == other.white && black == other.black && kings == other.kings && color == other.color;
+    }
+
+    //     :    180 ,     
+    // .      0,    7,      
+    Position flipped() const
+    {
+        Position pos;
+        pos.white = reverse_bits(black);
+        pos.black = reverse_bits(white);
+        pos.kings = reverse_bits(kings);
+        pos.color = !color;
+        return pos;
+    }
+
+    //   8x8  Board   
+    static Position from_mtx(const std::vector<std::vector<POS_T>>& mtx, const bool color)
+    {
+        Position pos;
+        pos.color = color;
+        for (POS_T s = 0; s < 32; ++s)
+            pos.set(s, mtx[square_x(s)][square_y(s)]);
+        return pos;
+    }
+
+    //    32     0..31 ( 0  ):
+    // '.' - , 'w' / 'b' -  /  , 'W' / 'B' -  /  
+    static Position from_string(const std::string& squares, const bool color)
+    {
+        Position pos;
+        pos.color = color;
+        for (POS_T s = 0; s < 32 && s < POS_T(squares.size()); ++s)
+        {
+            const size_t type = std::string(".wbWB").find(squares[s]);
+            if (type != std::string::npos)
+                pos.set(s, POS_T(type));
+        }
+        return pos;
+    }
+
+    //        (  )
+    std::string to_string() const
+    {
+        std::string squares(32, '.');
+        for (POS_T s = 0; s < 32; ++s)
+            squares[s] = ".wbWB"[at(s)];
+        return squares;
+    }
+
+    //     8x8  
+    std::vector<std::vector<POS_T>> to_mtx() const
+    {
+        std::vector<std::vector<POS_T>> mtx(8, std::vector<POS_T>(8, 0));
+        for (POS_T s = 0; s < 32; ++s)
+            mtx[square_x(s)][square_y(s)] = at(s);
+        return mtx;
+    }
+};
+
+//    ,     
+struct move_undo
+{
+    POS_T from = -1; // ,    
+    POS_T to = -1; // ,    
+    uint32_t beaten = 0; //   
+    uint32_t beaten_kings = 0; //   
+    bool promoted = false; //       
+    bool color = false; //     
+    uint64_t key = 0; //     
+};
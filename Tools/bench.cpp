@@ -0,0 +1,82 @@
+// Bench:          SDL.
+//          CSV:
+// , , ,   ,   ,   ,  ,
+//      ( -  30000),   O2,         ,  .
+//    settings.json,     ".=",
+// "depth=N"    (  8)
+#include <iostream>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "../Game/Logic.h"
+
+using namespace std;
+
+//     Position::from_string
+struct bench_position
+{
+    string name;
+    string squares;
+    bool color;
+};
+
+//       : ,     
+const vector<bench_position> suite = {
+    { "start", "bbbbbbbbbbbb........wwwwwwwwwwww", false },
+    { "opening", "bbbb...bb.bb.b......w.www..wwwww", false },
+    { "middlegame", "..bb.bb...bb........w.bw...w.www", false },
+    { "middlegame 2", "...b..bbb.b....b.w..w..w.w.w...w", false },
+    { "endgame", "W..b..b.................bbww....", false },
+    { "kings", "W.W................bw....B......", false },
+};
+
+int main(int argc, char** argv)
+{
+    Config config;
+    //  :   ,  ,   ,     
+    config.set("Bot", "BookFile", "");
+    config.set("Bot", "CacheFile", "");
+    config.set("Bot", "MaxThinkMS", 0);
+    config.set("Bot", "NoRandom", true);
+    config.set("Bot", "Threads", 1);
+    int depth = 8;
+    for (int i = 1; i < argc; ++i)
+    {
+        const string option = argv[i];
+        if (option.rfind("depth=", 0) == 0)
+            depth = stoi(option.substr(6));
+        else if (!config.set_option(option))
+            cerr << "Bad option " << option << ", expected Dir.Name=value\n";
+    }
+
+    printf("position,depth,nodes,ms,nps,ebf,move,score,lmr,lmr_research,futility,probcut,probcut_cuts,tablebase,cache,pv\n");
+    size_t total_nodes = 0;
+    double total_ms = 0;
+    for (const auto& test : suite)
+    {
+        Logic logic(&config); //     ,      
+        logic.Max_depth = depth;
+        logic.find_best_turns(Position::from_string(test.squares, test.color));
+        size_t prev_nodes = 0, prev_iteration = 0;
+        for (const auto& it : logic.last_iterations())
+        {
+            const size_t iteration_nodes = it.nodes - prev_nodes; //    
+            const double ebf = prev_iteration ? double(iteration_nodes) / prev_iteration : 0;
+            string pv; //     
+            for (const auto& turn : it.pv)
+                pv += (pv.empty() ? "" : " ") + turn.notation();
+            printf("%s,%d,%zu,%.1f,%.0f,%.2f,%s,%d,%zu,%zu,%zu,%zu,%zu,%zu,%zu,%s\n", test.name.c_str(), it.depth,
+                it.nodes, it.ms, it.nodes / max(it.ms, 0.001) * 1000, ebf, it.best.notation().c_str(), it.score,
+                it.stats.lmr, it.stats.lmr_research, it.stats.futility, it.stats.probcut, it.stats.probcut_cuts,
+                it.stats.tablebase, it.stats.cache, pv.c_str());
+            prev_nodes = it.nodes;
+            prev_iteration = iteration_nodes;
+        }
+        if (!logic.last_iterations().empty())
+            total_ms += logic.last_iterations().back().ms;
+        total_nodes += logic.searched_nodes();
+    }
+    printf("total,%d,%zu,%.1f,%.0f,,,,,,,,,,,\n", depth, total_nodes, total_ms, total_nodes / max(total_ms, 0.001) * 1000);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+// Bookgen:         .
+//        :      ,
+//           margin;     -    .
+// "bookgen [games=N] [turns=N] [depth=N] [margin=N] [file=] [threads=N] [.= ...]",
+//   64   12    10,  10  , book.bin,  ;
+//    Bot.BookFile
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Game/Logic.h"
+
+using namespace std;
+
+//        ,  :      
+vector<pair<full_move, int>> score_turns(Logic& logic, const Position& pos)
+{
+    vector<pair<full_move, int>> res;
+    move_list turns;
+    find_all_turns(pos, turns);
+    for (const auto& turn : turns)
+    {
+        Position next = pos;
+        move_undo undo;
+        apply_move(next, turn, undo);
+        move_list replies;
+        find_all_turns(next, replies);
+        if (replies.empty())
+        {
+            res.emplace_back(turn, mate_in(1)); //     -   
+            continue;
+        }
+        logic.find_best_turns(next);
+        const auto& iterations = logic.last_iterations();
+        res.emplace_back(turn, iterations.empty() ? 0 : -iterations.back().score);
+    }
+    return res;
+}
+
+int main(int argc, char** argv)
+{
+    Config config;
+    //   ,       ;      ,
+    //      .    
+    config.set("Bot", "MaxThinkMS", 0);
+    config.set("Bot", "NoRandom", false);
+    config.set("Bot", "Threads", 1);
+    config.set("Bot", "BookFile", "");
+    int games = 64, turns = 12, depth = 10, margin = 10;
+    string path = "book.bin";
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    for (int i = 1; i < argc; ++i)
+    {
+        const string option = argv[i];
+        const size_t eq = option.find('=');
+        const string name = option.substr(0, eq == string::npos ? 0 : eq), value = option.substr(eq + 1);
+        if (name == "games")
+            games = stoi(value);
+        else if (name == "turns")
+            turns = stoi(value);
+        else if (name == "depth")
+            depth = stoi(value);
+        else if (name == "margin")
+            margin = stoi(value);
+        else if (name == "file")
+            path = value;
+        else if (name == "threads")
+            threads = max(1, stoi(value));
+        else if (!config.set_option(option))
+            cerr << "Bad option " << option << "\n";
+    }
+
+    //  :   ->   ->   
+    map<uint64_t, map<uint64_t, uint32_t>> counts;
+    mutex counts_mutex;
+    atomic<int> next_game(0);
+    const auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&]() {
+            Logic logic(&config);
+            logic.Max_depth = max(depth - 1, 0); //     
+            for (int game = next_game++; game < games; game = next_game++)
+            {
+                default_random_engine rng(unsigned(game) + 1); //     
+                logic.set_seed(unsigned(game) + 1);
+                Position pos = Position::from_string("bbbbbbbbbbbb........wwwwwwwwwwww", false);
+                vector<pair<uint64_t, uint64_t>> played; //    
+                for (int turn = 0; turn < turns; ++turn)
+                {
+                    auto scored = score_turns(logic, pos);
+                    if (scored.empty())
+                        break; //  ,  
+                    int best_score = -INF;
+                    for (const auto& entry : scored)
+                        best_score = max(best_score, entry.second);
+                    //            
+                    auto too_weak = [&](const pair<full_move, int>& entry) { return entry.second < best_score - margin; };
+                    scored.erase(remove_if(scored.begin(), scored.end(), too_weak), scored.end());
+                    const full_move best = scored[uniform_int_distribution<size_t>(0, scored.size() - 1)(rng)].first;
+                    played.emplace_back(book_key(pos), packed_move(best).bits);
+                    move_undo undo;
+                    apply_move(pos, best, undo);
+                }
+                lock_guard<mutex> lock(counts_mutex);
+                for (const auto& entry : played)
+                    ++counts[entry.first][entry.second];
+                cout << "game " << game + 1 << " of " << games << "\n";
+            }
+        });
+    }
+    for (auto& th : workers)
+        th.join();
+
+    //  :      ,   -   
+    vector<book_entry> entries;
+    for (const auto& position : counts)
+    {
+        const size_t first = entries.size();
+        for (const auto& move : position.second)
+            entries.push_back({ position.first, move.first, move.second, 0 });
+        stable_sort(entries.begin() + first, entries.end(),
+            [](const book_entry& a, const book_entry& b) { return a.weight > b.weight; });
+    }
+    FILE* out = fopen(path.c_str(), "wb");
+    if (!out)
+    {
+        cerr << "Can't write " << path << "\n";
+        return 1;
+    }
+    const book_file_header header = { { 'C', 'K', 'O', 'B' }, BOOK_VERSION, uint64_t(entries.size()) };
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(entries.data(), sizeof(book_entry), entries.size(), out);
+    fclose(out);
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << path << ": " << counts.size() << " positions, " << entries.size() << " moves, " << (int)ms
+         << " millisec\n";
+    return 0;
+}
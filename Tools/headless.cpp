@@ -0,0 +1,46 @@
+// Headless:        SDL,       ,   .
+//     ,  ,       ,   - .
+// "headless [games=N] [.= ...]",    ;  Bot.NoRandom = false
+//       ,   
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "../Game/Match.h"
+
+using namespace std;
+
+int main(int argc, char** argv)
+{
+    Config config;
+    int games = 1;
+    for (int i = 1; i < argc; ++i)
+    {
+        const string option = argv[i];
+        if (option.rfind("games=", 0) == 0)
+            games = stoi(option.substr(6));
+        else if (!config.set_option(option))
+            cerr << "Bad option " << option << "\n";
+    }
+
+    const char* names[] = { "draw", "white wins", "black wins" };
+    int results[3] = { 0, 0, 0 };
+    const auto start = chrono::steady_clock::now();
+    for (int game = 0; game < games; ++game)
+    {
+        //     ,      :       
+        Logic logic(&config);
+        logic.set_seed(unsigned(game) + 1);
+        Match match({ &logic, config("Bot", "WhiteBotLevel") }, { &logic, config("Bot", "BlackBotLevel") },
+            config("Game", "MaxNumTurns"));
+        const match_result res = match.play();
+        ++results[res.result];
+        cout << "game " << game + 1 << ": " << names[res.result] << ", " << res.turns << " turns, white "
+             << (int)res.ms[0] << " millisec " << res.nodes[0] << " nodes, black " << (int)res.ms[1] << " millisec "
+             << res.nodes[1] << " nodes\n";
+    }
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "white wins " << results[1] << ", black wins " << results[2] << ", draws " << results[0] << ", "
+         << (int)ms << " millisec\n";
+    return 0;
+}
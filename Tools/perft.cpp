@@ -0,0 +1,124 @@
+// Perft:             .
+//     ,     .
+//          ,
+// "perft <> []"      
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Game/MoveGen.h"
+
+using namespace std;
+
+//     depth (depth >= 1),      
+size_t perft(Position& pos, const int depth)
+{
+    move_list turns;
+    find_all_turns(pos, turns);
+    if (depth == 1)
+        return turns.size();
+    size_t nodes = 0;
+    for (const auto& turn : turns)
+    {
+        move_undo undo;
+        apply_move(pos, turn, undo);
+        nodes += perft(pos, depth - 1);
+        revert_move(pos, undo);
+    }
+    return nodes;
+}
+
+// Perft      
+size_t perft_split(const Position& root, const int depth, const unsigned threads)
+{
+    if (depth <= 1 || threads <= 1)
+    {
+        Position pos = root;
+        return depth <= 0 ? 1 : perft(pos, depth);
+    }
+    move_list turns;
+    find_all_turns(root, turns);
+    atomic<int> next(0); //   ,     
+    atomic<size_t> total(0);
+    vector<thread> workers;
+    for (unsigned i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&]() {
+            for (int k = next++; k < turns.size(); k = next++)
+            {
+                Position pos = root;
+                move_undo undo;
+                apply_move(pos, turns[k], undo);
+                total += perft(pos, depth - 1);
+            }
+        });
+    }
+    for (auto& th : workers)
+        th.join();
+    return total;
+}
+
+//   (  Position::from_string)    perft   1, 2, ...
+struct perft_case
+{
+    string name;
+    string squares;
+    bool color;
+    vector<size_t> counts;
+};
+
+//  :      ,       
+const vector<perft_case> suite = {
+    { "start", "bbbbbbbbbbbb........wwwwwwwwwwww", false,
+        { 7, 49, 302, 1469, 7482, 37986, 190146, 929978, 4571311, 22480790 } },
+    { "long series", ".....Ww..W...w.Wb..b.Wb....w....", true,
+        { 2, 17, 22, 183, 735, 7381, 35360, 346828, 1938497 } },
+    { "promotion in series", ".....b.b.b.wW.b.b....WWw........", false,
+        { 3, 10, 54, 139, 949, 1828, 14820, 44605, 443299 } },
+    { "kings", "W.W.b...b..b..Ww......w..W.w...w", false,
+        { 29, 44, 330, 709, 8436, 21852, 222836, 675141 } },
+};
+
+int main(int argc, char** argv)
+{
+    const unsigned hw = max(1u, thread::hardware_concurrency());
+    if (argc > 1)
+    {
+        //     
+        const int depth = stoi(argv[1]);
+        const unsigned threads = argc > 2 ? stoi(argv[2]) : hw;
+        const auto start = chrono::steady_clock::now();
+        const size_t nodes = perft_split(Position::from_string(suite[0].squares, suite[0].color), depth, threads);
+        const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << "perft " << depth << ": " << nodes << " nodes, " << (int)ms << " millisec, "
+             << (size_t)(nodes / max(ms, 1.0) * 1000) << " nodes/sec, threads: " << threads << "\n";
+        return 0;
+    }
+
+    //     
+    bool ok = true;
+    size_t total = 0;
+    const auto start = chrono::steady_clock::now();
+    for (const auto& test : suite)
+    {
+        const Position pos = Position::from_string(test.squares, test.color);
+        for (size_t depth = 1; depth <= test.counts.size(); ++depth)
+        {
+            const size_t nodes = perft_split(pos, int(depth), hw);
+            total += nodes;
+            if (nodes != test.counts[depth - 1])
+            {
+                cout << test.name << " depth " << depth << ": expected " << test.counts[depth - 1] << ", got " << nodes
+                     << "\n";
+                ok = false;
+            }
+        }
+    }
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << (ok ? "OK" : "FAILED") << ", nodes: " << total << ", " << (int)ms << " millisec, "
+         << (size_t)(total / max(ms, 1.0) * 1000) << " nodes/sec\n";
+    return ok ? 0 : 1;
+}
\ No newline at end of file
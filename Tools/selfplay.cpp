@@ -0,0 +1,139 @@
+// Selfplay:            ,   .
+//    random   (  ),       level,
+//        ;   ,   .
+//        (Game/Dataset.h),   - DatasetReader.
+// "selfplay [games=N] [level=N] [random=N] [file=] [threads=N] [.= ...]",
+//   1000    6, 4  , dataset.bin,  .
+// "selfplay read="        ,   
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Game/Dataset.h"
+#include "../Game/Match.h"
+
+using namespace std;
+
+//   
+int read_dataset(const string& path)
+{
+    const auto start = chrono::steady_clock::now();
+    DatasetReader reader;
+    if (!reader.open(path))
+    {
+        cerr << "Can't read " << path << "\n";
+        return 1;
+    }
+    size_t results[3] = { 0, 0, 0 }; // , ,  
+    reader.for_each([&](const dataset_record& rec) { ++results[rec.result + 1]; });
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << path << ": " << reader.size() << " positions in " << reader.chunk_count() << " chunks, side to move wins "
+         << results[2] << ", draws " << results[1] << ", loses " << results[0] << ", " << (int)ms << " millisec\n";
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    Config config;
+    //   ,       ;    ,
+    //     .      
+    config.set("Bot", "MaxThinkMS", 0);
+    config.set("Bot", "Threads", 1);
+    config.set("Bot", "HashMB", 16);
+    config.set("Bot", "BookFile", "");
+    config.set("Bot", "CacheFile", "");
+    int games = 1000, level = 6, random_plies = 4;
+    string path = "dataset.bin";
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    for (int i = 1; i < argc; ++i)
+    {
+        const string option = argv[i];
+        const size_t eq = option.find('=');
+        const string name = option.substr(0, eq == string::npos ? 0 : eq), value = option.substr(eq + 1);
+        if (name == "read")
+            return read_dataset(value);
+        else if (name == "games")
+            games = stoi(value);
+        else if (name == "level")
+            level = stoi(value);
+        else if (name == "random")
+            random_plies = stoi(value);
+        else if (name == "file")
+            path = value;
+        else if (name == "threads")
+            threads = max(1, stoi(value));
+        else if (!config.set_option(option))
+            cerr << "Bad option " << option << "\n";
+    }
+
+    DatasetWriter writer;
+    if (!writer.open(path))
+    {
+        cerr << "Can't write " << path << "\n";
+        return 1;
+    }
+    const int max_turns = config("Game", "MaxNumTurns");
+    atomic<int> next_game(0), finished(0);
+    const auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&]() {
+            vector<dataset_record> records; //   
+            for (int game = next_game++; game < games; game = next_game++)
+            {
+                //   
+                default_random_engine rng(unsigned(game) + 1);
+                Position pos = BoardState().get_position(false);
+                move_list turns;
+                for (int ply = 0; ply < random_plies; ++ply)
+                {
+                    find_all_turns(pos, turns);
+                    if (turns.empty())
+                        break;
+                    move_undo undo;
+                    apply_move(pos, turns[uniform_int_distribution<int>(0, int(turns.size()) - 1)(rng)], undo);
+                }
+                find_all_turns(pos, turns);
+                if (turns.empty())
+                    continue; //     
+
+                Logic logic(&config);
+                logic.set_seed(unsigned(game) + 1);
+                Match match({ &logic, level }, { &logic, level }, max_turns);
+                records.clear();
+                match.on_turn = [&](const Position& turn_pos, const full_move& best, const Logic& searched) {
+                    const auto& iterations = searched.last_iterations();
+                    if (!iterations.empty())
+                        records.push_back(dataset_record::of(turn_pos, iterations.back().score, best));
+                };
+                const int result = match.play(pos).result;
+                //   ,     : 1 -  , 2 -  
+                for (auto& rec : records)
+                    rec.result = int8_t(result == 0 ? 0 : (result == 1) == (rec.color == 0) ? 1 : -1);
+                writer.write(records.data(), records.size());
+
+                const int done = ++finished;
+                if (done % 100 == 0)
+                {
+                    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                    printf("games %d, positions %zu, %.0f positions/hour\n", done, writer.size(),
+                        writer.size() * 3600000.0 / max(ms, 1.0));
+                    fflush(stdout);
+                }
+            }
+        });
+    }
+    for (auto& th : workers)
+        th.join();
+    writer.close();
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << path << ": " << finished << " games, " << writer.size() << " positions, " << (int)ms << " millisec\n";
+    return 0;
+}
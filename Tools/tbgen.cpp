@@ -0,0 +1,216 @@
+// Tbgen:              .
+// "tbgen <> [] []",    tablebase.bin    (0  -   );  
+//  Bot.TablebaseFile.        ,  ,
+//        ,     
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Game/MoveGen.h"
+#include "../Game/Tablebase.h"
+
+using namespace std;
+
+const uint8_t UNKNOWN = 0; //    (  - )
+const uint8_t INVALID = 255; //   ,     0
+
+vector<uint8_t> values[(TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1)];
+
+//     , UNKNOWN -   
+uint8_t lookup(const Position& pos)
+{
+    if (!pos.white)
+        return 1; //    - 
+    const tb_slice slice = tb_slice::of(pos);
+    return values[slice.id()][slice.index(pos)];
+}
+
+//   v     : ,       v - 1 ,
+// ,          v - 1 .    
+//      v - 1 ,      
+bool solves_at(const Position& pos, const int v)
+{
+    move_list turns;
+    find_all_turns(pos, turns);
+    if (turns.empty())
+        return v == 1;
+    bool all_win = true;
+    for (const auto& turn : turns)
+    {
+        Position next = pos;
+        move_undo undo;
+        apply_move(next, turn, undo);
+        const int value = lookup(next.flipped());
+        if (v % 2 == 0 && value == v - 1)
+            return true; //    
+        if (!tb_is_win(value) || value >= v)
+            all_win = false;
+    }
+    return v % 2 == 1 && all_win;
+}
+
+//   to      from   :
+//         
+bool reachable(const tb_slice& from, const tb_slice& to)
+{
+    return to.wm <= from.wm && to.wm + to.wk <= from.wm + from.wk && to.bm <= from.bm && to.bm + to.bk <= from.bm + from.bk;
+}
+
+//   ,       (      );
+// deps -    ,       
+bool solve_group(const vector<tb_slice>& group, const int deps, const unsigned threads)
+{
+    for (const auto& slice : group)
+    {
+        auto& table = values[slice.id()];
+        table.assign(slice.size(), UNKNOWN);
+        Position pos;
+        for (uint64_t i = 0; i < table.size(); ++i)
+            if (!slice.position(i, pos))
+                table[i] = INVALID;
+    }
+    //      ,      -    .
+    //  ,      ,      1 - 2  ,
+    //    ,       deps + 2
+    int empty_passes = 0; //  ,   
+    for (int v = 1; empty_passes < 2 || v <= deps + 2; ++v)
+    {
+        size_t solved = 0;
+        for (const auto& slice : group)
+        {
+            auto& table = values[slice.id()];
+            //    ,     
+            atomic<uint64_t> next(0);
+            vector<vector<uint64_t>> found(threads);
+            vector<thread> workers;
+            for (unsigned t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&, t]() {
+                    const uint64_t chunk = 4096;
+                    Position pos;
+                    for (uint64_t begin = next.fetch_add(chunk); begin < table.size(); begin = next.fetch_add(chunk))
+                        for (uint64_t i = begin; i < min(begin + chunk, uint64_t(table.size())); ++i)
+                            if (table[i] == UNKNOWN && slice.position(i, pos) && solves_at(pos, v))
+                                found[t].push_back(i);
+                });
+            }
+            for (auto& th : workers)
+                th.join();
+            for (const auto& list : found)
+            {
+                if (!list.empty() && v > TB_MAX_VALUE)
+                {
+                    cerr << "Too long endgame, more than " << TB_MAX_VALUE << " turns\n";
+                    return false;
+                }
+            }
+            for (const auto& list : found)
+            {
+                for (const uint64_t i : list)
+                    table[i] = uint8_t(v);
+                solved += list.size();
+            }
+        }
+        empty_passes = (solved ? 0 : empty_passes + 1);
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        cout << "Usage: tbgen <pieces> [file] [threads]\n";
+        return 1;
+    }
+    const int max_pieces = stoi(argv[1]);
+    const string path = argc > 2 ? argv[2] : "tablebase.bin";
+    // 0 ,    Bot.Threads, -  
+    const int requested = argc > 3 ? stoi(argv[3]) : 0;
+    const unsigned threads = requested > 0 ? unsigned(requested) : max(1u, thread::hardware_concurrency());
+    if (max_pieces < 2 || max_pieces > TB_MAX_PIECES)
+    {
+        cerr << "Pieces must be from 2 to " << TB_MAX_PIECES << "\n";
+        return 1;
+    }
+
+    //  ,      .    ,  -  ,
+    //           (, )      
+    vector<tb_slice> slices;
+    for (int wm = 0; wm <= max_pieces; ++wm)
+        for (int wk = 0; wm + wk <= max_pieces; ++wk)
+            for (int bm = 0; wm + wk + bm <= max_pieces; ++bm)
+                for (int bk = 0; wm + wk + bm + bk <= max_pieces; ++bk)
+                    if (wm + wk && bm + bk)
+                        slices.push_back({ wm, wk, bm, bk });
+    stable_sort(slices.begin(), slices.end(), [](const tb_slice& a, const tb_slice& b) {
+        return make_pair(a.pieces(), a.wm + a.bm) < make_pair(b.pieces(), b.wm + b.bm);
+    });
+
+    const auto start = chrono::steady_clock::now();
+    vector<bool> done((TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1) * (TB_MAX_PIECES + 1));
+    vector<int> top(done.size(), 0); //      
+    for (const auto& slice : slices)
+    {
+        if (done[slice.id()])
+            continue;
+        vector<tb_slice> group = { slice };
+        if (slice.flipped().id() != slice.id())
+            group.push_back(slice.flipped());
+        int deps = 1; //    -    1
+        for (const auto& solved : slices)
+            if (done[solved.id()] && (reachable(slice, solved) || reachable(slice, solved.flipped())))
+                deps = max(deps, top[solved.id()]);
+        if (!solve_group(group, deps, threads))
+            return 1;
+        for (const auto& solved : group)
+        {
+            done[solved.id()] = true;
+            size_t wins = 0, losses = 0, draws = 0;
+            int longest = 0; //      
+            for (const uint8_t v : values[solved.id()])
+            {
+                if (v == INVALID)
+                    continue;
+                (v == UNKNOWN ? draws : tb_is_win(v) ? wins : losses)++;
+                longest = max(longest, v - 1);
+                top[solved.id()] = max(top[solved.id()], int(v));
+            }
+            printf("%d%d%d%d: %zu positions, wins %zu, losses %zu, draws %zu, longest %d turns\n", solved.wm,
+                solved.wk, solved.bm, solved.bk, wins + losses + draws, wins, losses, draws, longest);
+        }
+    }
+
+    //  : ,   ,   (  - )
+    FILE* out = fopen(path.c_str(), "wb");
+    if (!out)
+    {
+        cerr << "Can't write " << path << "\n";
+        return 1;
+    }
+    tb_file_header header = { { 'C', 'K', 'T', 'B' }, TB_VERSION, uint32_t(max_pieces), uint32_t(slices.size()) };
+    fwrite(&header, sizeof(header), 1, out);
+    uint64_t offset = sizeof(header) + slices.size() * sizeof(tb_file_slice);
+    for (const auto& slice : slices)
+    {
+        tb_file_slice entry = { uint8_t(slice.wm), uint8_t(slice.wk), uint8_t(slice.bm), uint8_t(slice.bk), 0, offset,
+            slice.size() };
+        fwrite(&entry, sizeof(entry), 1, out);
+        offset += slice.size();
+    }
+    for (const auto& slice : slices)
+    {
+        auto& table = values[slice.id()];
+        replace(table.begin(), table.end(), INVALID, UNKNOWN);
+        fwrite(table.data(), 1, table.size(), out);
+    }
+    fclose(out);
+    const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << path << ": " << slices.size() << " slices, " << offset << " bytes, " << (int)ms << " millisec\n";
+    return 0;
+}
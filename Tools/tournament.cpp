@@ -0,0 +1,285 @@
+// Tournament:     (A  B)     ,   .
+//         ;       (Elo)
+//    SPRT: H0 - A  B     elo0, H1 -     elo1.
+//  ,          .
+// "tournament [games=N] [threads=N] [plies=N] [openings=] [level=N] [elo0=X] [elo1=X] [alpha=X] [beta=X]
+//  [.= ...] [A.level=N] [B.level=N] [A..= ...] [B..= ...]",
+//  "tournament A.Bot.Optimization=O2 B.Bot.Optimization=O1 level=6".
+//   1000 ,  ,  -    3    ,
+//  6, elo0 = 0, elo1 = 10, alpha = beta = 0.05;        16  
+// ,     .   -  "<32  Position::from_string> w|b"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <mutex>
+#include <set>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Game/Match.h"
+
+using namespace std;
+
+//    
+struct engine
+{
+    Config config;
+    int level = 6;
+};
+
+//     plies    ,    
+void collect_openings(const Position& pos, const int plies, set<pair<string, bool>>& res)
+{
+    move_list turns;
+    find_all_turns(pos, turns);
+    if (turns.empty())
+        return;
+    if (plies == 0)
+    {
+        res.emplace(pos.to_string(), pos.color);
+        return;
+    }
+    for (const auto& turn : turns)
+    {
+        Position next = pos;
+        move_undo undo;
+        apply_move(next, turn, undo);
+        collect_openings(next, plies - 1, res);
+    }
+}
+
+//    ,  "<32 > w|b",      # 
+bool read_openings(const string& path, vector<Position>& res)
+{
+    ifstream fin(path);
+    if (!fin)
+        return false;
+    string squares, color;
+    while (fin >> squares)
+    {
+        if (squares[0] == '#')
+        {
+            getline(fin, squares);
+            continue;
+        }
+        fin >> color;
+        if (squares.size() != 32)
+            return false;
+        res.push_back(Position::from_string(squares, color == "b"));
+    }
+    return true;
+}
+
+//        elo
+double elo_to_score(const double elo)
+{
+    return 1 / (1 + pow(10, -elo / 400));
+}
+
+//      
+double score_to_elo(const double score)
+{
+    return -400 * log10(1 / score - 1);
+}
+
+//     : pairs[k] -  ,   A  k / 2    (0 - 4 )
+struct tournament_stats
+{
+    size_t pairs[5] = { 0, 0, 0, 0, 0 };
+    size_t wins = 0, losses = 0, draws = 0; //  A
+
+    size_t pair_count() const
+    {
+        return pairs[0] + pairs[1] + pairs[2] + pairs[3] + pairs[4];
+    }
+
+    //    A       
+    void score(double& mean, double& variance) const
+    {
+        const double n = double(pair_count());
+        mean = variance = 0;
+        for (int k = 0; k < 5; ++k)
+            mean += pairs[k] * (k / 4.0) / n;
+        for (int k = 0; k < 5; ++k)
+            variance += pairs[k] * (k / 4.0 - mean) * (k / 4.0 - mean) / n;
+    }
+
+    //    H1  H0      
+    double llr(const double elo0, const double elo1) const
+    {
+        const size_t n = pair_count();
+        double mean, variance;
+        score(mean, variance);
+        if (!n || variance <= 0)
+            return 0;
+        const double s0 = elo_to_score(elo0), s1 = elo_to_score(elo1);
+        return n * (s1 - s0) * (2 * mean - s0 - s1) / (2 * variance);
+    }
+
+    //    A  B   95%  
+    void elo(double& diff, double& margin) const
+    {
+        const size_t n = pair_count();
+        double mean, variance;
+        score(mean, variance);
+        const double clamp = 1e-6, spread = 1.96 * sqrt(variance / max<size_t>(n, 1));
+        diff = score_to_elo(min(max(mean, clamp), 1 - clamp));
+        margin = (score_to_elo(min(mean + spread, 1 - clamp)) - score_to_elo(max(mean - spread, clamp))) / 2;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    engine engines[2];
+    int games = 1000, plies = 3;
+    string openings_path;
+    double elo0 = 0, elo1 = 10, alpha = 0.05, beta = 0.05;
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    //      ,       
+    for (auto& e : engines)
+    {
+        e.config.set("Bot", "Threads", 1);
+        e.config.set("Bot", "HashMB", 16);
+        e.config.set("Bot", "BookFile", "");
+        e.config.set("Bot", "CacheFile", "");
+    }
+    for (int i = 1; i < argc; ++i)
+    {
+        string option = argv[i];
+        //    : "A.="  "B.="
+        int only = -1;
+        if (option.size() > 2 && (option[0] == 'A' || option[0] == 'B') && option[1] == '.')
+        {
+            only = option[0] - 'A';
+            option = option.substr(2);
+        }
+        const size_t eq = option.find('=');
+        const string name = option.substr(0, eq == string::npos ? 0 : eq), value = option.substr(eq + 1);
+        bool ok = true;
+        if (name == "level")
+        {
+            for (int e = 0; e < 2; ++e)
+                if (only == -1 || only == e)
+                    engines[e].level = stoi(value);
+        }
+        else if (only == -1 && name == "games")
+            games = stoi(value);
+        else if (only == -1 && name == "threads")
+            threads = max(1, stoi(value));
+        else if (only == -1 && name == "plies")
+            plies = stoi(value);
+        else if (only == -1 && name == "openings")
+            openings_path = value;
+        else if (only == -1 && name == "elo0")
+            elo0 = stod(value);
+        else if (only == -1 && name == "elo1")
+            elo1 = stod(value);
+        else if (only == -1 && name == "alpha")
+            alpha = stod(value);
+        else if (only == -1 && name == "beta")
+            beta = stod(value);
+        else
+        {
+            for (int e = 0; e < 2; ++e)
+                if (only == -1 || only == e)
+                    ok = engines[e].config.set_option(option) && ok;
+        }
+        if (!ok)
+            cerr << "Bad option " << argv[i] << "\n";
+    }
+
+    //  
+    vector<Position> openings;
+    if (!openings_path.empty())
+    {
+        if (!read_openings(openings_path, openings) || openings.empty())
+        {
+            cerr << "Can't read openings from " << openings_path << "\n";
+            return 1;
+        }
+    }
+    else
+    {
+        set<pair<string, bool>> unique;
+        collect_openings(BoardState().get_position(false), plies, unique);
+        for (const auto& opening : unique)
+            openings.push_back(Position::from_string(opening.first, opening.second));
+    }
+    const int max_turns = engines[0].config("Game", "MaxNumTurns");
+    const int pairs = (games + 1) / 2;
+    const double lower = log(beta / (1 - alpha)), upper = log((1 - beta) / alpha); //  SPRT
+    cout << openings.size() << " openings, " << pairs * 2 << " games at most, " << threads << " threads, SPRT elo0 "
+         << elo0 << " elo1 " << elo1 << ", LLR bounds " << lower << " " << upper << "\n";
+
+    tournament_stats stats;
+    mutex stats_mutex;
+    atomic<int> next_pair(0);
+    atomic<bool> stop(false);
+    int verdict = 0; // 1 -  H1, -1 -  H0
+    size_t reported = 0; //     
+    const auto start = chrono::steady_clock::now();
+
+    //   
+    auto report = [&]() {
+        reported = stats.pair_count();
+        double diff, margin;
+        stats.elo(diff, margin);
+        const double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        printf("games %zu: A wins %zu, B wins %zu, draws %zu, elo %.1f +- %.1f, LLR %.2f, %d millisec\n",
+            stats.pair_count() * 2, stats.wins, stats.losses, stats.draws, diff, margin, stats.llr(elo0, elo1), int(ms));
+        fflush(stdout);
+    };
+
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&]() {
+            for (int p = next_pair++; p < pairs && !stop; p = next_pair++)
+            {
+                const Position& opening = openings[p % openings.size()];
+                int points = 0; //   A  
+                int results[2];
+                //    - A  ,  - A  
+                for (int swap = 0; swap < 2; ++swap)
+                {
+                    //     ,         
+                    Logic a(&engines[0].config), b(&engines[1].config);
+                    a.set_seed(unsigned(p) * 2 + 1);
+                    b.set_seed(unsigned(p) * 2 + 2);
+                    const match_player pa{ &a, engines[0].level }, pb{ &b, engines[1].level };
+                    Match match(swap ? pb : pa, swap ? pa : pb, max_turns);
+                    const int res = match.play(opening).result;
+                    //  A:    ,   
+                    results[swap] = (res == 0 ? 0 : (res == 1) != bool(swap) ? 1 : -1);
+                    points += results[swap] + 1;
+                }
+                lock_guard<mutex> lock(stats_mutex);
+                ++stats.pairs[points];
+                for (const int r : results)
+                    ++(r > 0 ? stats.wins : r < 0 ? stats.losses : stats.draws);
+                const double llr = stats.llr(elo0, elo1);
+                if (!verdict && (llr >= upper || llr <= lower))
+                {
+                    verdict = (llr >= upper ? 1 : -1);
+                    stop = true; // ,   ,      
+                }
+                if (stats.pair_count() % 50 == 0)
+                    report();
+            }
+        });
+    }
+    for (auto& th : workers)
+        th.join();
+
+    if (stats.pair_count() != reported)
+        report();
+    cout << (verdict > 0 ? "H1 accepted: A is stronger by at least elo1"
+                         : verdict < 0 ? "H0 accepted: A is not stronger than elo0" : "Inconclusive")
+         << "\n";
+    return 0;
+}